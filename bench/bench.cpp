@@ -0,0 +1,857 @@
+// Copyright: 2012-2018 by Andreas Eckner
+// License: GPL-2 | GPL-3
+// Remark: Standalone micro-benchmark for the C kernels in src/. Synthetic unevenly spaced time series with different
+//         arrival patterns are generated for a sweep of lengths and rolling window widths, and for each kernel the
+//         running time per observation and the additional peak resident memory (of a single run in a fresh process)
+//         are reported as JSON, so that results of different builds can be diffed (see --compare).
+//
+// Usage: utsbench [--n 1e4,1e5,1e6] [--widths 10,100,1000] [--datasets poisson,bursty,gaps,trend]
+//                 [--kernels PREFIX] [--reps 5] [--threads 1,2] [--output FILE] [--compare BASELINE]
+// -) window widths are specified in multiples of the average observation time spacing
+// -) a kernel is benchmarked if its name starts with one of the comma-separated PREFIXes
+// -) multi-threaded kernels (suffix "_parallel") are benchmarked for each number of threads, together with the speedup
+//    relative to one thread, and all other kernels with one thread
+// -) single-precision kernels (suffix "_float") get the same observation values, rounded to float
+// -) query kernels (suffix "_query") are evaluated halfway between consecutive observation times
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+extern "C" {
+#include "ema.h"
+#include "rolling.h"
+#include "sma.h"
+}
+
+#define BENCH_FORMAT_VERSION 2
+#define NUM_COLS 4            // number of time series for batch kernels
+#define NUM_TAUS 4            // number of half-lives for EMA banks
+
+
+/****************** Synthetic time series ******************/
+
+struct Series
+{
+  std::vector<double> times;
+  std::vector<double> values;
+};
+
+
+// Generate a time series with n observations and an average observation time spacing of about one second
+// -) poisson: exponentially distributed time spacings, random walk observation values
+// -) bursty: clusters of rapidly arriving ticks (e.g. trades after news), separated by quiet periods
+// -) gaps: like 'poisson', but with occasional large gaps (e.g. nights and weekends)
+// -) trend: like 'poisson', but with strictly increasing observation values (worst case for rolling minimum)
+static Series generate_series(const std::string& dataset, ptrdiff_t n, unsigned int seed)
+{
+  std::mt19937_64 rng(seed);
+  std::exponential_distribution<double> exp_spacing(1.0);
+  std::normal_distribution<double> noise(0.0, 1.0);
+  std::uniform_real_distribution<double> unif(0.0, 1.0);
+
+  Series x;
+  x.times.resize(n);
+  x.values.resize(n);
+  double time = 0, value = 0;
+  ptrdiff_t burst_left = 0;
+  for (ptrdiff_t i = 0; i < n; i++) {
+    double spacing;
+    if (dataset == "bursty") {
+      if ((burst_left == 0) && (unif(rng) < 0.02))
+        burst_left = 1 + (ptrdiff_t) (100 * unif(rng));
+      if (burst_left > 0) {
+        spacing = 0.01 * exp_spacing(rng);
+        burst_left--;
+      } else
+        spacing = 1.5 * exp_spacing(rng);
+    } else if (dataset == "gaps") {
+      spacing = (unif(rng) < 0.001) ? 500 * (1 + unif(rng)) : 0.25 * exp_spacing(rng);
+    } else
+      spacing = exp_spacing(rng);
+    time += spacing;
+    value += (dataset == "trend") ? 0.001 * (1 + unif(rng)) : noise(rng);
+    x.times[i] = time;
+    x.values[i] = value;
+  }
+  return x;
+}
+
+
+// Observation values for the batch kernels (NUM_COLS multiples of the values) and the single-precision kernels
+static void derived_values(const Series& x, std::vector<double> *values_batch, std::vector<float> *values_float)
+{
+  ptrdiff_t n = x.values.size();
+  values_batch->resize(n * NUM_COLS);
+  for (ptrdiff_t i = 0; i < n; i++) {
+    for (int k = 0; k < NUM_COLS; k++)
+      (*values_batch)[k + i * NUM_COLS] = (k + 1) * x.values[i];
+  }
+  values_float->assign(x.values.begin(), x.values.end());
+}
+
+
+/****************** Kernels ******************/
+
+// Input of a kernel benchmark
+struct Input
+{
+  ptrdiff_t n;
+  const double *times;
+  const double *values;        // n observation values
+  const float *values_float;   // n observation values in single precision
+  const double *values_batch;  // n x NUM_COLS observation values in row-major order
+  double width;                // rolling window width in seconds
+  const double *start_times;   // static time windows
+  const double *end_times;
+  ptrdiff_t num_windows;
+  const double *query_times;   // n query times
+  int num_threads;
+};
+
+
+struct Kernel
+{
+  std::string name;
+  int num_outputs;        // number of output values per observation (or per static window)
+  bool is_static;         // output for static time windows?
+  std::function<void(const Input&, double*)> run;
+  bool is_float = false;  // single-precision output, stored in the first half of the output buffer?
+  bool is_query = false;  // output at query times halfway between the observation times?
+};
+
+
+// Kernels with a right-aligned rolling time window of the given width, or an EMA with half-life equal to the width
+#define WINDOW_KERNEL(fct) \
+  {#fct, 1, false, [](const Input& in, double *out) { \
+    double width_after = 0; \
+    fct##_long(in.values, in.times, &in.n, out, &in.width, &width_after); }}
+#define BATCH_KERNEL(fct) \
+  {#fct, NUM_COLS, false, [](const Input& in, double *out) { \
+    double width_after = 0; int num_cols = NUM_COLS; \
+    fct##_long(in.values_batch, in.times, &in.n, out, &in.width, &width_after, &num_cols); }}
+#define PARALLEL_KERNEL(fct) \
+  {#fct, 1, false, [](const Input& in, double *out) { \
+    double width_after = 0; int min_chunk = 10000; \
+    fct##_long(in.values, in.times, &in.n, out, &in.width, &width_after, &in.num_threads, &min_chunk); }}
+#define STATIC_KERNEL(fct) \
+  {#fct, 1, true, [](const Input& in, double *out) { \
+    fct##_long(in.values, in.times, &in.n, out, in.start_times, in.end_times, &in.num_windows); }}
+#define FLOAT_KERNEL(fct) \
+  {#fct "_float", 1, false, [](const Input& in, double *out) { \
+    double width_after = 0; \
+    fct##_float_long(in.values_float, in.times, &in.n, (float*) out, &in.width, &width_after); }, true}
+#define SMA_QUERY_KERNEL(fct) \
+  {#fct, 1, false, [](const Input& in, double *out) { \
+    double width_after = 0; \
+    fct##_long(in.values, in.times, &in.n, out, &in.width, &width_after, in.query_times, &in.n); }, false, true}
+#define EMA_KERNEL(fct) \
+  {#fct, 1, false, [](const Input& in, double *out) { \
+    fct##_long(in.values, in.times, &in.n, out, &in.width); }}
+#define EMA_BATCH_KERNEL(fct) \
+  {#fct, NUM_COLS, false, [](const Input& in, double *out) { \
+    int num_cols = NUM_COLS; \
+    fct##_long(in.values_batch, in.times, &in.n, out, &in.width, &num_cols); }}
+#define EMA_BANK_KERNEL(fct) \
+  {#fct, NUM_TAUS, false, [](const Input& in, double *out) { \
+    double tau[NUM_TAUS] = {in.width / 4, in.width / 2, in.width, 2 * in.width}; int num_taus = NUM_TAUS; \
+    fct##_long(in.values, in.times, &in.n, out, tau, &num_taus); }}
+#define EMA_FLOAT_KERNEL(fct) \
+  {#fct "_float", 1, false, [](const Input& in, double *out) { \
+    fct##_float_long(in.values_float, in.times, &in.n, (float*) out, &in.width); }, true}
+#define EMA_PARALLEL_KERNEL(fct) \
+  {#fct, 1, false, [](const Input& in, double *out) { \
+    fct##_long(in.values, in.times, &in.n, out, &in.width, &in.num_threads); }}
+#define EMA_QUERY_KERNEL(fct) \
+  {#fct, 1, false, [](const Input& in, double *out) { \
+    fct##_long(in.values, in.times, &in.n, out, &in.width, in.query_times, &in.n); }, false, true}
+
+
+/****************** Variants of the EMA kernels ******************/
+// -) the decay weights are calculated in a separate pass over blocks of observations, which can be vectorized, and
+//    only the multiply-add of the recursion stays serial
+// -) not used by the package, because they are not faster than the fused loop in ema_template.h, where the processor
+//    already overlaps the calls to exp() with the serial multiply-add of the recursion (e.g. with gcc-12.2 -O2 for
+//    ema_last: 13.2 vs. 13.8 (libm) vs. 19.5 (polynomial) ns/obs), but kept so that the comparison can be reproduced
+
+#define EMA_SPLIT_BLOCK 256   // number of decay weights calculated in one pass
+
+
+// exp(x) for x <= 0 without branches inside the range, so that gcc can vectorize loops calling it (max. error ~1 ulp)
+static inline double exp_nonpositive(double x)
+{
+  const double shifter = 6755399441055744.0;   // 1.5 * 2^52
+  const double ln2_hi = 6.93147180369123816490e-01, ln2_lo = 1.90821492927058770002e-10;
+  double xc = (x < -708) ? -708 : x;
+  
+  // Reduce x = k * log(2) + r with |r| <= log(2) / 2, and evaluate Taylor polynomial of exp(r)
+  double t = xc * 1.4426950408889634074 + shifter;
+  double k = t - shifter;
+  double r = (xc - k * ln2_hi) - k * ln2_lo;
+  double p = 1.0 / 6227020800.0;
+  p = p * r + 1.0 / 479001600.0;
+  p = p * r + 1.0 / 39916800.0;
+  p = p * r + 1.0 / 3628800.0;
+  p = p * r + 1.0 / 362880.0;
+  p = p * r + 1.0 / 40320.0;
+  p = p * r + 1.0 / 5040.0;
+  p = p * r + 1.0 / 720.0;
+  p = p * r + 1.0 / 120.0;
+  p = p * r + 1.0 / 24.0;
+  p = p * r + 1.0 / 6.0;
+  p = p * r + 0.5;
+  p = p * r + 1.0;
+  p = p * r + 1.0;
+  
+  // Multiply by 2^k, whose exponent bits are in the low bits of t
+  uint64_t bits;
+  double scale;
+  memcpy(&bits, &t, sizeof(bits));
+  bits = (bits + 1023) << 52;
+  memcpy(&scale, &bits, sizeof(scale));
+  return (x < -708) ? 0 : p * scale;
+}
+
+
+static inline double exp_libm(double x)
+{
+  return exp(x);
+}
+
+
+// EMA_last(X, tau) and EMA_next(X, tau) with a separate pass for the decay weights
+template <double (*EXP)(double), bool NEXT>
+static void ema_split_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *tau)
+{
+  double w[EMA_SPLIT_BLOCK], x[EMA_SPLIT_BLOCK];
+  
+  if (*n == 0)
+    return;
+  values_new[0] = values[0];
+  for (ptrdiff_t start = 1; start < *n; start += EMA_SPLIT_BLOCK) {
+    ptrdiff_t len = std::min<ptrdiff_t>(EMA_SPLIT_BLOCK, *n - start);
+    for (ptrdiff_t j = 0; j < len; j++) {
+      w[j] = EXP(-(times[start + j] - times[start + j - 1]) / *tau);
+      x[j] = (NEXT ? values[start + j] : values[start + j - 1]) * (1 - w[j]);
+    }
+    for (ptrdiff_t j = 0; j < len; j++)
+      values_new[start + j] = values_new[start + j - 1] * w[j] + x[j];
+  }
+}
+
+
+// EMA_lin(X, tau) with a separate pass for the decay weights
+template <double (*EXP)(double)>
+static void ema_linear_split_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *tau)
+{
+  double w[EMA_SPLIT_BLOCK], x[EMA_SPLIT_BLOCK];
+  
+  if (*n == 0)
+    return;
+  values_new[0] = values[0];
+  for (ptrdiff_t start = 1; start < *n; start += EMA_SPLIT_BLOCK) {
+    ptrdiff_t len = std::min<ptrdiff_t>(EMA_SPLIT_BLOCK, *n - start);
+    for (ptrdiff_t j = 0; j < len; j++) {
+      double tmp = (times[start + j] - times[start + j - 1]) / *tau;
+      double w_j = EXP(-tmp);
+      double w2 = (tmp > 1e-6) ? (1 - w_j) / tmp : 1 - tmp/2 + tmp*tmp/6 - tmp*tmp*tmp/24;
+      w[j] = w_j;
+      x[j] = values[start + j] * (1 - w2) + values[start + j - 1] * (w2 - w_j);
+    }
+    for (ptrdiff_t j = 0; j < len; j++)
+      values_new[start + j] = values_new[start + j - 1] * w[j] + x[j];
+  }
+}
+
+
+static const std::vector<Kernel>& all_kernels()
+{
+  static const std::vector<Kernel> kernels = {
+    // Rolling operators
+    {"rolling_central_moment", 1, false, [](const Input& in, double *out) {
+      double width_after = 0, m = 3;
+      rolling_central_moment_long(in.values, in.times, &in.n, out, &in.width, &width_after, &m); }},
+    WINDOW_KERNEL(rolling_kurtosis),
+    WINDOW_KERNEL(rolling_log_product),
+    WINDOW_KERNEL(rolling_max),
+    WINDOW_KERNEL(rolling_mean),
+    WINDOW_KERNEL(rolling_median),
+    WINDOW_KERNEL(rolling_min),
+    WINDOW_KERNEL(rolling_num_obs),
+    WINDOW_KERNEL(rolling_product),
+    {"rolling_quantile", 3, false, [](const Input& in, double *out) {
+      double width_after = 0, probs[3] = {0.1, 0.5, 0.9}; int num_probs = 3;
+      rolling_quantile_long(in.values, in.times, &in.n, out, &in.width, &width_after, probs, &num_probs); }},
+    WINDOW_KERNEL(rolling_sd),
+    WINDOW_KERNEL(rolling_skewness),
+    WINDOW_KERNEL(rolling_sum),
+    WINDOW_KERNEL(rolling_sum_exact),
+    WINDOW_KERNEL(rolling_sum_neumaier),
+    WINDOW_KERNEL(rolling_sum_stable),
+    WINDOW_KERNEL(rolling_var),
+    {"rolling_summary", 7, false, [](const Input& in, double *out) {
+      double width_after = 0;
+      int stats[7] = {SUMMARY_NUM_OBS, SUMMARY_SUM, SUMMARY_MEAN, SUMMARY_VAR, SUMMARY_SD, SUMMARY_MIN, SUMMARY_MAX};
+      int num_stats = 7;
+      rolling_summary_long(in.values, in.times, &in.n, out, &in.width, &width_after, stats, &num_stats); }},
+    BATCH_KERNEL(rolling_max_batch),
+    BATCH_KERNEL(rolling_mean_batch),
+    BATCH_KERNEL(rolling_min_batch),
+    BATCH_KERNEL(rolling_sd_batch),
+    BATCH_KERNEL(rolling_sum_batch),
+    BATCH_KERNEL(rolling_var_batch),
+    PARALLEL_KERNEL(rolling_max_parallel),
+    PARALLEL_KERNEL(rolling_mean_parallel),
+    PARALLEL_KERNEL(rolling_min_parallel),
+    PARALLEL_KERNEL(rolling_num_obs_parallel),
+    PARALLEL_KERNEL(rolling_sum_parallel),
+    STATIC_KERNEL(rolling_static_max),
+    STATIC_KERNEL(rolling_static_mean),
+    STATIC_KERNEL(rolling_static_median),
+    STATIC_KERNEL(rolling_static_min),
+    STATIC_KERNEL(rolling_static_num_obs),
+    STATIC_KERNEL(rolling_static_product),
+    STATIC_KERNEL(rolling_static_sum),
+    STATIC_KERNEL(rolling_static_var),
+    FLOAT_KERNEL(rolling_max),
+    FLOAT_KERNEL(rolling_mean),
+    FLOAT_KERNEL(rolling_min),
+    FLOAT_KERNEL(rolling_num_obs),
+    FLOAT_KERNEL(rolling_sd),
+    FLOAT_KERNEL(rolling_sum),
+    FLOAT_KERNEL(rolling_var),
+
+    // Simple moving averages
+    WINDOW_KERNEL(sma_last),
+    WINDOW_KERNEL(sma_linear),
+    WINDOW_KERNEL(sma_next),
+    BATCH_KERNEL(sma_last_batch),
+    BATCH_KERNEL(sma_linear_batch),
+    BATCH_KERNEL(sma_next_batch),
+    PARALLEL_KERNEL(sma_last_parallel),
+    PARALLEL_KERNEL(sma_linear_parallel),
+    PARALLEL_KERNEL(sma_next_parallel),
+    FLOAT_KERNEL(sma_last),
+    FLOAT_KERNEL(sma_linear),
+    FLOAT_KERNEL(sma_next),
+    SMA_QUERY_KERNEL(sma_last_query),
+    SMA_QUERY_KERNEL(sma_linear_query),
+    SMA_QUERY_KERNEL(sma_next_query),
+
+    // Exponential moving averages
+    EMA_KERNEL(ema_last),
+    EMA_KERNEL(ema_linear),
+    EMA_KERNEL(ema_next),
+    EMA_BATCH_KERNEL(ema_last_batch),
+    EMA_BATCH_KERNEL(ema_linear_batch),
+    EMA_BATCH_KERNEL(ema_next_batch),
+    EMA_BANK_KERNEL(ema_last_bank),
+    EMA_BANK_KERNEL(ema_linear_bank),
+    EMA_BANK_KERNEL(ema_next_bank),
+    EMA_PARALLEL_KERNEL(ema_last_parallel),
+    EMA_PARALLEL_KERNEL(ema_linear_parallel),
+    EMA_PARALLEL_KERNEL(ema_next_parallel),
+    EMA_KERNEL(ema_last_reverse),
+    EMA_KERNEL(ema_linear_reverse),
+    EMA_KERNEL(ema_next_reverse),
+    EMA_BANK_KERNEL(ema_last_reverse_bank),
+    EMA_BANK_KERNEL(ema_linear_reverse_bank),
+    EMA_BANK_KERNEL(ema_next_reverse_bank),
+    EMA_PARALLEL_KERNEL(ema_last_reverse_parallel),
+    EMA_PARALLEL_KERNEL(ema_linear_reverse_parallel),
+    EMA_PARALLEL_KERNEL(ema_next_reverse_parallel),
+    EMA_FLOAT_KERNEL(ema_last),
+    EMA_FLOAT_KERNEL(ema_linear),
+    EMA_FLOAT_KERNEL(ema_next),
+    EMA_QUERY_KERNEL(ema_last_query),
+    EMA_QUERY_KERNEL(ema_linear_query),
+    EMA_QUERY_KERNEL(ema_next_query),
+    {"ema_iterated", 1, false, [](const Input& in, double *out) {
+      int interpolation = EMA_LAST, k = 4; double weights[4] = {0.25, 0.25, 0.25, 0.25};
+      ema_iterated_long(in.values, in.times, &in.n, out, &in.width, &interpolation, weights, &k); }},
+    {"ema_iterated_var", 1, false, [](const Input& in, double *out) {
+      int interpolation = EMA_LAST, k = 4; double weights[4] = {0.25, 0.25, 0.25, 0.25};
+      ema_iterated_var_long(in.values, in.times, &in.n, out, &in.width, &interpolation, weights, &k); }},
+    {"ema_last_split", 1, false, [](const Input& in, double *out) {
+      ema_split_long<exp_libm, false>(in.values, in.times, &in.n, out, &in.width); }},
+    {"ema_last_split_poly", 1, false, [](const Input& in, double *out) {
+      ema_split_long<exp_nonpositive, false>(in.values, in.times, &in.n, out, &in.width); }},
+    {"ema_linear_split", 1, false, [](const Input& in, double *out) {
+      ema_linear_split_long<exp_libm>(in.values, in.times, &in.n, out, &in.width); }},
+    {"ema_linear_split_poly", 1, false, [](const Input& in, double *out) {
+      ema_linear_split_long<exp_nonpositive>(in.values, in.times, &in.n, out, &in.width); }},
+    {"ema_next_split", 1, false, [](const Input& in, double *out) {
+      ema_split_long<exp_libm, true>(in.values, in.times, &in.n, out, &in.width); }},
+    {"ema_next_split_poly", 1, false, [](const Input& in, double *out) {
+      ema_split_long<exp_nonpositive, true>(in.values, in.times, &in.n, out, &in.width); }}
+  };
+  return kernels;
+}
+
+
+/****************** Measurement ******************/
+
+struct Result
+{
+  std::string kernel, dataset;
+  ptrdiff_t n;
+  double width;               // in multiples of the average observation time spacing
+  double ns_per_obs;          // fastest repetition
+  double ns_per_obs_median;   // median repetition
+  long peak_rss_kb;           // additional peak resident memory (including output), or -1 if not available
+  double checksum;            // sum of finite output values, for spotting changes of the output
+  int num_threads;
+  double speedup;             // running time with one thread divided by running time, for multi-threaded kernels
+};
+
+
+// Whether a kernel is multi-threaded
+static bool is_parallel(const std::string& kernel)
+{
+  return kernel.find("_parallel") != std::string::npos;
+}
+
+
+// Peak resident memory of the current process in kB
+// -) on Linux, the peak is read from /proc, because ru_maxrss is carried over by exec(), so that it would include the
+//    peak of the benchmark process that started the measurement in measure_memory()
+static long peak_rss_kb()
+{
+#ifdef _WIN32
+  return -1;
+#else
+#ifdef __linux__
+  std::ifstream status("/proc/self/status");
+  std::string line;
+  while (std::getline(status, line)) {
+    if (line.compare(0, 6, "VmHWM:") == 0)
+      return std::atol(line.c_str() + 6);
+  }
+#endif
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+  return usage.ru_maxrss / 1024;   // bytes on macOS
+#else
+  return usage.ru_maxrss;
+#endif
+#endif
+}
+
+
+// Input of a kernel benchmark, together with the static time windows and query times that it points to
+struct Workload
+{
+  Input in;
+  std::vector<double> start_times, end_times, query_times;
+  ptrdiff_t num_out;    // number of output values
+  ptrdiff_t out_size;   // size of the output buffer in doubles
+};
+
+
+static void prepare_workload(Workload *work, const Kernel& kernel, const Series& x,
+  const std::vector<float>& values_float, const std::vector<double>& values_batch, double width_obs, int num_threads)
+{
+  // Rolling window width in seconds, and static time windows moved forward by half the width at a time
+  // -) the vectors are reserved upfront, so that measure_memory() does not see memory freed by their reallocation
+  ptrdiff_t n = x.times.size();
+  double avg_spacing = (n > 1) ? (x.times[n - 1] - x.times[0]) / (n - 1) : 1;
+  double width = width_obs * avg_spacing;
+  if (kernel.is_static) {
+    work->start_times.reserve((std::size_t) (2 * (x.times[n - 1] - x.times[0] + width) / width) + 2);
+    work->end_times.reserve(work->start_times.capacity());
+    for (double start = x.times[0] - width; start < x.times[n - 1]; start += width / 2) {
+      work->start_times.push_back(start);
+      work->end_times.push_back(start + width);
+    }
+  }
+  
+  // Query times halfway between consecutive observation times, and the last observation time
+  if (kernel.is_query) {
+    work->query_times.reserve(n);
+    for (ptrdiff_t i = 0; i < n - 1; i++)
+      work->query_times.push_back(x.times[i] + (x.times[i + 1] - x.times[i]) / 2);
+    work->query_times.push_back(x.times[n - 1]);
+  }
+
+  Input& in = work->in;
+  in.n = n;
+  in.times = x.times.data();
+  in.values = x.values.data();
+  in.values_float = values_float.data();
+  in.values_batch = values_batch.data();
+  in.width = width;
+  in.start_times = work->start_times.data();
+  in.end_times = work->end_times.data();
+  in.num_windows = work->start_times.size();
+  in.query_times = work->query_times.data();
+  in.num_threads = num_threads;
+
+  // The output buffer of single-precision kernels only needs half as many doubles
+  work->num_out = (kernel.is_static ? in.num_windows : n) * kernel.num_outputs;
+  work->out_size = kernel.is_float ? (work->num_out + 1) / 2 : work->num_out;
+}
+
+
+// Path of the running executable, for re-invoking it to measure the memory usage of a kernel
+static std::string self_path;
+
+
+// Run a kernel once in a new instance of this program (see --memory in main()), and return the increase of the peak
+// resident memory, including the output buffer
+// -) the new instance starts with a fresh heap, so that the result does not depend on the memory that earlier
+//    measurements allocated and freed, and on the peak of earlier measurements
+static long measure_memory(const Kernel& kernel, const std::string& dataset, ptrdiff_t n, double width_obs,
+  int num_threads)
+{
+#ifdef _WIN32
+  return -1;
+#else
+  char n_str[32], width_str[32], threads_str[32];
+  std::snprintf(n_str, sizeof(n_str), "%td", n);
+  std::snprintf(width_str, sizeof(width_str), "%.17g", width_obs);
+  std::snprintf(threads_str, sizeof(threads_str), "%d", num_threads);
+  int fd[2];
+  if (pipe(fd) != 0)
+    return -1;
+  pid_t pid = fork();
+  if (pid < 0) {
+    close(fd[0]);
+    close(fd[1]);
+    return -1;
+  }
+  if (pid == 0) {
+    close(fd[0]);
+    if (dup2(fd[1], STDOUT_FILENO) < 0)
+      _exit(1);
+    execl(self_path.c_str(), self_path.c_str(), "--memory", kernel.name.c_str(), "--datasets", dataset.c_str(),
+      "--n", n_str, "--widths", width_str, "--threads", threads_str, (char*) NULL);
+    _exit(1);
+  }
+  close(fd[1]);
+  std::string reply;
+  char buffer[64];
+  ssize_t len;
+  while ((len = read(fd[0], buffer, sizeof(buffer))) > 0)
+    reply.append(buffer, len);
+  close(fd[0]);
+  int status;
+  if ((waitpid(pid, &status, 0) != pid) || !WIFEXITED(status) || (WEXITSTATUS(status) != 0) || reply.empty())
+    return -1;
+  return std::atol(reply.c_str());
+#endif
+}
+
+
+static Result run_benchmark(const Kernel& kernel, const std::string& dataset, const Series& x,
+  const std::vector<float>& values_float, const std::vector<double>& values_batch, double width_obs, int reps,
+  int num_threads)
+{
+  Workload work;
+  prepare_workload(&work, kernel, x, values_float, values_batch, width_obs, num_threads);
+  const Input& in = work.in;
+  ptrdiff_t n = in.n, num_out = work.num_out;
+
+  // Time repetitions (after one warm-up run)
+  std::vector<double> out(work.out_size);
+  kernel.run(in, out.data());
+  std::vector<double> elapsed;
+  for (int r = 0; r < reps; r++) {
+    auto start = std::chrono::steady_clock::now();
+    kernel.run(in, out.data());
+    auto end = std::chrono::steady_clock::now();
+    elapsed.push_back(std::chrono::duration<double, std::nano>(end - start).count() / n);
+  }
+  std::sort(elapsed.begin(), elapsed.end());
+
+  Result res;
+  res.kernel = kernel.name;
+  res.dataset = dataset;
+  res.n = n;
+  res.width = width_obs;
+  res.ns_per_obs = elapsed[0];
+  res.ns_per_obs_median = elapsed[elapsed.size() / 2];
+  res.peak_rss_kb = measure_memory(kernel, dataset, n, width_obs, num_threads);
+  res.num_threads = num_threads;
+  res.speedup = 1;
+  res.checksum = 0;
+  const float *out_float = (const float*) out.data();
+  for (ptrdiff_t i = 0; i < num_out; i++) {
+    double value = kernel.is_float ? out_float[i] : out[i];
+    if (std::isfinite(value))
+      res.checksum += value;
+  }
+  return res;
+}
+
+
+/****************** Input and output ******************/
+
+static std::vector<std::string> split(const std::string& s)
+{
+  std::vector<std::string> out;
+  std::stringstream in(s);
+  std::string item;
+  while (std::getline(in, item, ','))
+    if (!item.empty())
+      out.push_back(item);
+  return out;
+}
+
+
+static std::string result_key(const std::string& kernel, const std::string& dataset, ptrdiff_t n, double width,
+  int num_threads)
+{
+  std::ostringstream key;
+  key << kernel << "/" << dataset << "/n=" << n << "/width=" << width;
+  if (is_parallel(kernel))
+    key << "/threads=" << num_threads;
+  return key.str();
+}
+
+
+// Format a result as a JSON object on a single line (which allows --compare to parse it without a JSON library)
+static std::string to_json(const Result& res)
+{
+  std::ostringstream out;
+  out.precision(17);
+  out << "{\"kernel\": \"" << res.kernel << "\", \"dataset\": \"" << res.dataset << "\", \"n\": " << res.n
+    << ", \"width\": " << res.width;
+  out.precision(4);
+  out << ", \"ns_per_obs\": " << res.ns_per_obs << ", \"ns_per_obs_median\": " << res.ns_per_obs_median
+    << ", \"peak_rss_kb\": " << res.peak_rss_kb << ", \"threads\": " << res.num_threads;
+  if (is_parallel(res.kernel))
+    out << ", \"speedup\": " << res.speedup;
+  out.precision(17);
+  out << ", \"checksum\": " << res.checksum << "}";
+  return out.str();
+}
+
+
+// Extract a field from a single-line JSON object written by to_json()
+static std::string json_field(const std::string& line, const std::string& field)
+{
+  std::string pattern = "\"" + field + "\": ";
+  std::size_t pos = line.find(pattern);
+  if (pos == std::string::npos)
+    return "";
+  pos += pattern.size();
+  if (line[pos] == '"')
+    return line.substr(pos + 1, line.find('"', pos + 1) - pos - 1);
+  return line.substr(pos, line.find_first_of(",}", pos) - pos);
+}
+
+
+// Read the timings of a previous run, keyed by kernel, dataset, length and width
+static std::map<std::string, double> read_baseline(const std::string& file)
+{
+  std::map<std::string, double> baseline;
+  std::ifstream in(file.c_str());
+  if (!in) {
+    std::cerr << "Cannot open baseline file '" << file << "'\n";
+    std::exit(1);
+  }
+  // Results of format version 1 have no number of threads, which was the same for all multi-threaded kernels
+  std::string line;
+  int num_threads = 1;
+  while (std::getline(in, line)) {
+    if (line.find("\"kernel\"") == std::string::npos) {
+      if (line.find("\"threads\": ") != std::string::npos)
+        num_threads = std::atoi(json_field(line, "threads").c_str());
+      continue;
+    }
+    std::string threads = json_field(line, "threads");
+    std::string key = result_key(json_field(line, "kernel"), json_field(line, "dataset"),
+      std::atoll(json_field(line, "n").c_str()), std::atof(json_field(line, "width").c_str()),
+      threads.empty() ? num_threads : std::atoi(threads.c_str()));
+    baseline[key] = std::atof(json_field(line, "ns_per_obs").c_str());
+  }
+  return baseline;
+}
+
+
+int main(int argc, char *argv[])
+{
+  // Default settings
+  std::vector<std::string> n_list = split("1e4,1e5,1e6");
+  std::vector<std::string> width_list = split("10,100,1000");
+  std::vector<std::string> datasets = split("poisson,bursty,gaps,trend");
+  std::vector<std::string> prefixes;
+  std::vector<std::string> thread_list = split("1,2");
+  int reps = 5;
+  std::string output, compare, memory_kernel;
+  self_path = argv[0];
+#ifdef __linux__
+  self_path = "/proc/self/exe";
+#endif
+
+  // Parse command line
+  for (int j = 1; j < argc; j++) {
+    std::string arg = argv[j];
+    if (j + 1 >= argc) {
+      std::cerr << "Missing value for argument " << arg << "\n";
+      return 1;
+    }
+    std::string value = argv[++j];
+    if (arg == "--n")
+      n_list = split(value);
+    else if (arg == "--widths")
+      width_list = split(value);
+    else if (arg == "--datasets")
+      datasets = split(value);
+    else if (arg == "--kernels")
+      prefixes = split(value);
+    else if (arg == "--reps")
+      reps = std::max(1, std::atoi(value.c_str()));
+    else if (arg == "--threads")
+      thread_list = split(value);
+    else if (arg == "--output")
+      output = value;
+    else if (arg == "--compare")
+      compare = value;
+    else if (arg == "--memory")
+      memory_kernel = value;
+    else {
+      std::cerr << "Unknown argument " << arg << "\n";
+      return 1;
+    }
+  }
+
+  // Numbers of threads in increasing order
+  std::vector<int> threads;
+  for (const std::string& thread_str : thread_list)
+    threads.push_back(std::max(1, std::atoi(thread_str.c_str())));
+  if (threads.empty())
+    threads.push_back(1);
+  std::sort(threads.begin(), threads.end());
+  threads.erase(std::unique(threads.begin(), threads.end()), threads.end());
+
+  // Internal mode used by measure_memory(): run the kernel with the given name once for the first dataset, length,
+  // width, and number of threads, and print the increase of the peak resident memory in kB
+  if (!memory_kernel.empty()) {
+    for (const Kernel& kernel : all_kernels()) {
+      if (kernel.name != memory_kernel)
+        continue;
+      Series x = generate_series(datasets[0], (ptrdiff_t) std::atof(n_list[0].c_str()), 12345);
+      std::vector<double> values_batch;
+      std::vector<float> values_float;
+      derived_values(x, &values_batch, &values_float);
+      Workload work;
+      prepare_workload(&work, kernel, x, values_float, values_batch, std::atof(width_list[0].c_str()), threads[0]);
+      // Run the kernel on a short prefix of the input first, so that faulting in its code is not counted
+      Input prefix = work.in;
+      prefix.n = std::min(prefix.n, (ptrdiff_t) 100);
+      prefix.num_windows = std::min(prefix.num_windows, (ptrdiff_t) 100);
+      std::vector<double> out_prefix(100 * kernel.num_outputs);
+      kernel.run(prefix, out_prefix.data());
+      long before = peak_rss_kb();
+      std::vector<double> out(work.out_size);
+      kernel.run(work.in, out.data());
+      std::printf("%ld\n", peak_rss_kb() - before);
+      return 0;
+    }
+    std::cerr << "Unknown kernel " << memory_kernel << "\n";
+    return 1;
+  }
+
+  std::map<std::string, double> baseline;
+  if (!compare.empty())
+    baseline = read_baseline(compare);
+
+  // Run benchmarks, and print progress (and the comparison with the baseline) to stderr
+  std::vector<Result> results;
+  for (const std::string& dataset : datasets) {
+    if ((dataset != "poisson") && (dataset != "bursty") && (dataset != "gaps") && (dataset != "trend")) {
+      std::cerr << "Unknown dataset " << dataset << "\n";
+      return 1;
+    }
+    for (const std::string& n_str : n_list) {
+      ptrdiff_t n = (ptrdiff_t) std::atof(n_str.c_str());
+      if (n < 2)
+        continue;
+      Series x = generate_series(dataset, n, 12345);
+      std::vector<double> values_batch;
+      std::vector<float> values_float;
+      derived_values(x, &values_batch, &values_float);
+
+      for (const std::string& width_str : width_list) {
+        double width_obs = std::atof(width_str.c_str());
+        for (const Kernel& kernel : all_kernels()) {
+          bool selected = prefixes.empty();
+          for (const std::string& prefix : prefixes)
+            selected = selected || (kernel.name.compare(0, prefix.size(), prefix) == 0);
+          if (!selected)
+            continue;
+
+          // Multi-threaded kernels are run with each number of threads, and compared with a run with one thread
+          // (which is not reported if one thread is not in the list)
+          std::vector<int> kernel_threads(1, 1);
+          if (is_parallel(kernel.name))
+            kernel_threads = threads;
+          double ns_one_thread = 0;
+          if (kernel_threads[0] != 1) {
+            Result res = run_benchmark(kernel, dataset, x, values_float, values_batch, width_obs, reps, 1);
+            ns_one_thread = res.ns_per_obs;
+          }
+          for (int num_threads : kernel_threads) {
+            Result res = run_benchmark(kernel, dataset, x, values_float, values_batch, width_obs, reps, num_threads);
+            if (num_threads == 1)
+              ns_one_thread = res.ns_per_obs;
+            res.speedup = ns_one_thread / res.ns_per_obs;
+            results.push_back(res);
+            std::fprintf(stderr, "%-26s %-8s n=%-9td width=%-6g %9.2f ns/obs %8ld kB", res.kernel.c_str(),
+              res.dataset.c_str(), res.n, res.width, res.ns_per_obs, res.peak_rss_kb);
+            if (is_parallel(res.kernel))
+              std::fprintf(stderr, "   %2d threads %5.2fx", res.num_threads, res.speedup);
+            std::map<std::string, double>::const_iterator it = baseline.find(result_key(res.kernel, res.dataset,
+              res.n, res.width, res.num_threads));
+            if (it != baseline.end())
+              std::fprintf(stderr, "   %+7.1f%% vs. baseline", 100 * (res.ns_per_obs / it->second - 1));
+            std::fprintf(stderr, "\n");
+          }
+        }
+      }
+    }
+  }
+
+  // Write JSON output
+  std::ostringstream json;
+  json << "{\n  \"format_version\": " << BENCH_FORMAT_VERSION << ",\n";
+#ifdef __VERSION__
+  json << "  \"compiler\": \"" << __VERSION__ << "\",\n";
+#endif
+  json << "  \"reps\": " << reps << ",\n  \"threads\": [";
+  for (std::size_t j = 0; j < threads.size(); j++)
+    json << threads[j] << ((j + 1 < threads.size()) ? ", " : "");
+  json << "],\n  \"results\": [\n";
+  for (std::size_t j = 0; j < results.size(); j++)
+    json << "    " << to_json(results[j]) << ((j + 1 < results.size()) ? ",\n" : "\n");
+  json << "  ]\n}\n";
+  if (output.empty())
+    std::cout << json.str();
+  else {
+    std::ofstream out(output.c_str());
+    out << json.str();
+  }
+  return 0;
+}
@@ -44,52 +44,674 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// Rcpp_wrapper_ema_last_batch
+Rcpp::NumericMatrix Rcpp_wrapper_ema_last_batch(const Rcpp::NumericMatrix& values, const Rcpp::DatetimeVector& times, double tau);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_ema_last_batch(SEXP valuesSEXP, SEXP timesSEXP, SEXP tauSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const Rcpp::NumericMatrix& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::DatetimeVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< double >::type tau(tauSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_ema_last_batch(values, times, tau));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_ema_linear_batch
+Rcpp::NumericMatrix Rcpp_wrapper_ema_linear_batch(const Rcpp::NumericMatrix& values, const Rcpp::DatetimeVector& times, double tau);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_ema_linear_batch(SEXP valuesSEXP, SEXP timesSEXP, SEXP tauSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const Rcpp::NumericMatrix& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::DatetimeVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< double >::type tau(tauSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_ema_linear_batch(values, times, tau));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_ema_next_batch
+Rcpp::NumericMatrix Rcpp_wrapper_ema_next_batch(const Rcpp::NumericMatrix& values, const Rcpp::DatetimeVector& times, double tau);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_ema_next_batch(SEXP valuesSEXP, SEXP timesSEXP, SEXP tauSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const Rcpp::NumericMatrix& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::DatetimeVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< double >::type tau(tauSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_ema_next_batch(values, times, tau));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_ema_last_bank
+Rcpp::NumericMatrix Rcpp_wrapper_ema_last_bank(const Rcpp::NumericVector& values, const Rcpp::DatetimeVector& times, const Rcpp::NumericVector& tau);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_ema_last_bank(SEXP valuesSEXP, SEXP timesSEXP, SEXP tauSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const Rcpp::NumericVector& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::DatetimeVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::NumericVector& >::type tau(tauSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_ema_last_bank(values, times, tau));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_ema_linear_bank
+Rcpp::NumericMatrix Rcpp_wrapper_ema_linear_bank(const Rcpp::NumericVector& values, const Rcpp::DatetimeVector& times, const Rcpp::NumericVector& tau);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_ema_linear_bank(SEXP valuesSEXP, SEXP timesSEXP, SEXP tauSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const Rcpp::NumericVector& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::DatetimeVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::NumericVector& >::type tau(tauSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_ema_linear_bank(values, times, tau));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_ema_next_bank
+Rcpp::NumericMatrix Rcpp_wrapper_ema_next_bank(const Rcpp::NumericVector& values, const Rcpp::DatetimeVector& times, const Rcpp::NumericVector& tau);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_ema_next_bank(SEXP valuesSEXP, SEXP timesSEXP, SEXP tauSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const Rcpp::NumericVector& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::DatetimeVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::NumericVector& >::type tau(tauSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_ema_next_bank(values, times, tau));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_ema_last_parallel
+Rcpp::NumericVector Rcpp_wrapper_ema_last_parallel(const Rcpp::NumericVector& values, const Rcpp::DatetimeVector& times, double tau, int num_threads);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_ema_last_parallel(SEXP valuesSEXP, SEXP timesSEXP, SEXP tauSEXP, SEXP num_threadsSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const Rcpp::NumericVector& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::DatetimeVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< double >::type tau(tauSEXP);
+    Rcpp::traits::input_parameter< int >::type num_threads(num_threadsSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_ema_last_parallel(values, times, tau, num_threads));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_ema_linear_parallel
+Rcpp::NumericVector Rcpp_wrapper_ema_linear_parallel(const Rcpp::NumericVector& values, const Rcpp::DatetimeVector& times, double tau, int num_threads);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_ema_linear_parallel(SEXP valuesSEXP, SEXP timesSEXP, SEXP tauSEXP, SEXP num_threadsSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const Rcpp::NumericVector& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::DatetimeVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< double >::type tau(tauSEXP);
+    Rcpp::traits::input_parameter< int >::type num_threads(num_threadsSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_ema_linear_parallel(values, times, tau, num_threads));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_ema_next_parallel
+Rcpp::NumericVector Rcpp_wrapper_ema_next_parallel(const Rcpp::NumericVector& values, const Rcpp::DatetimeVector& times, double tau, int num_threads);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_ema_next_parallel(SEXP valuesSEXP, SEXP timesSEXP, SEXP tauSEXP, SEXP num_threadsSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const Rcpp::NumericVector& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::DatetimeVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< double >::type tau(tauSEXP);
+    Rcpp::traits::input_parameter< int >::type num_threads(num_threadsSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_ema_next_parallel(values, times, tau, num_threads));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_ema_iterated
+Rcpp::NumericVector Rcpp_wrapper_ema_iterated(const Rcpp::NumericVector& values, const Rcpp::DatetimeVector& times, double tau, int interpolation, const Rcpp::NumericVector& weights);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_ema_iterated(SEXP valuesSEXP, SEXP timesSEXP, SEXP tauSEXP, SEXP interpolationSEXP, SEXP weightsSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const Rcpp::NumericVector& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::DatetimeVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< double >::type tau(tauSEXP);
+    Rcpp::traits::input_parameter< int >::type interpolation(interpolationSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::NumericVector& >::type weights(weightsSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_ema_iterated(values, times, tau, interpolation, weights));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_ema_iterated_var
+Rcpp::NumericVector Rcpp_wrapper_ema_iterated_var(const Rcpp::NumericVector& values, const Rcpp::DatetimeVector& times, double tau, int interpolation, const Rcpp::NumericVector& weights);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_ema_iterated_var(SEXP valuesSEXP, SEXP timesSEXP, SEXP tauSEXP, SEXP interpolationSEXP, SEXP weightsSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const Rcpp::NumericVector& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::DatetimeVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< double >::type tau(tauSEXP);
+    Rcpp::traits::input_parameter< int >::type interpolation(interpolationSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::NumericVector& >::type weights(weightsSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_ema_iterated_var(values, times, tau, interpolation, weights));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_ema_last_query
+Rcpp::NumericVector Rcpp_wrapper_ema_last_query(const Rcpp::NumericVector& values, const Rcpp::DatetimeVector& times, double tau, const Rcpp::DatetimeVector& query_times);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_ema_last_query(SEXP valuesSEXP, SEXP timesSEXP, SEXP tauSEXP, SEXP query_timesSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const Rcpp::NumericVector& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::DatetimeVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< double >::type tau(tauSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::DatetimeVector& >::type query_times(query_timesSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_ema_last_query(values, times, tau, query_times));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_ema_linear_query
+Rcpp::NumericVector Rcpp_wrapper_ema_linear_query(const Rcpp::NumericVector& values, const Rcpp::DatetimeVector& times, double tau, const Rcpp::DatetimeVector& query_times);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_ema_linear_query(SEXP valuesSEXP, SEXP timesSEXP, SEXP tauSEXP, SEXP query_timesSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const Rcpp::NumericVector& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::DatetimeVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< double >::type tau(tauSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::DatetimeVector& >::type query_times(query_timesSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_ema_linear_query(values, times, tau, query_times));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_ema_next_query
+Rcpp::NumericVector Rcpp_wrapper_ema_next_query(const Rcpp::NumericVector& values, const Rcpp::DatetimeVector& times, double tau, const Rcpp::DatetimeVector& query_times);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_ema_next_query(SEXP valuesSEXP, SEXP timesSEXP, SEXP tauSEXP, SEXP query_timesSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const Rcpp::NumericVector& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::DatetimeVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< double >::type tau(tauSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::DatetimeVector& >::type query_times(query_timesSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_ema_next_query(values, times, tau, query_times));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_ema_last_reverse
+Rcpp::NumericVector Rcpp_wrapper_ema_last_reverse(const Rcpp::NumericVector& values, const Rcpp::DatetimeVector& times, double tau);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_ema_last_reverse(SEXP valuesSEXP, SEXP timesSEXP, SEXP tauSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const Rcpp::NumericVector& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::DatetimeVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< double >::type tau(tauSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_ema_last_reverse(values, times, tau));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_ema_linear_reverse
+Rcpp::NumericVector Rcpp_wrapper_ema_linear_reverse(const Rcpp::NumericVector& values, const Rcpp::DatetimeVector& times, double tau);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_ema_linear_reverse(SEXP valuesSEXP, SEXP timesSEXP, SEXP tauSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const Rcpp::NumericVector& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::DatetimeVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< double >::type tau(tauSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_ema_linear_reverse(values, times, tau));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_ema_next_reverse
+Rcpp::NumericVector Rcpp_wrapper_ema_next_reverse(const Rcpp::NumericVector& values, const Rcpp::DatetimeVector& times, double tau);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_ema_next_reverse(SEXP valuesSEXP, SEXP timesSEXP, SEXP tauSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const Rcpp::NumericVector& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::DatetimeVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< double >::type tau(tauSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_ema_next_reverse(values, times, tau));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_ema_last_reverse_bank
+Rcpp::NumericMatrix Rcpp_wrapper_ema_last_reverse_bank(const Rcpp::NumericVector& values, const Rcpp::DatetimeVector& times, const Rcpp::NumericVector& tau);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_ema_last_reverse_bank(SEXP valuesSEXP, SEXP timesSEXP, SEXP tauSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const Rcpp::NumericVector& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::DatetimeVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::NumericVector& >::type tau(tauSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_ema_last_reverse_bank(values, times, tau));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_ema_linear_reverse_bank
+Rcpp::NumericMatrix Rcpp_wrapper_ema_linear_reverse_bank(const Rcpp::NumericVector& values, const Rcpp::DatetimeVector& times, const Rcpp::NumericVector& tau);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_ema_linear_reverse_bank(SEXP valuesSEXP, SEXP timesSEXP, SEXP tauSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const Rcpp::NumericVector& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::DatetimeVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::NumericVector& >::type tau(tauSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_ema_linear_reverse_bank(values, times, tau));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_ema_next_reverse_bank
+Rcpp::NumericMatrix Rcpp_wrapper_ema_next_reverse_bank(const Rcpp::NumericVector& values, const Rcpp::DatetimeVector& times, const Rcpp::NumericVector& tau);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_ema_next_reverse_bank(SEXP valuesSEXP, SEXP timesSEXP, SEXP tauSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const Rcpp::NumericVector& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::DatetimeVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::NumericVector& >::type tau(tauSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_ema_next_reverse_bank(values, times, tau));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_ema_last_reverse_parallel
+Rcpp::NumericVector Rcpp_wrapper_ema_last_reverse_parallel(const Rcpp::NumericVector& values, const Rcpp::DatetimeVector& times, double tau, int num_threads);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_ema_last_reverse_parallel(SEXP valuesSEXP, SEXP timesSEXP, SEXP tauSEXP, SEXP num_threadsSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const Rcpp::NumericVector& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::DatetimeVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< double >::type tau(tauSEXP);
+    Rcpp::traits::input_parameter< int >::type num_threads(num_threadsSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_ema_last_reverse_parallel(values, times, tau, num_threads));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_ema_linear_reverse_parallel
+Rcpp::NumericVector Rcpp_wrapper_ema_linear_reverse_parallel(const Rcpp::NumericVector& values, const Rcpp::DatetimeVector& times, double tau, int num_threads);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_ema_linear_reverse_parallel(SEXP valuesSEXP, SEXP timesSEXP, SEXP tauSEXP, SEXP num_threadsSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const Rcpp::NumericVector& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::DatetimeVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< double >::type tau(tauSEXP);
+    Rcpp::traits::input_parameter< int >::type num_threads(num_threadsSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_ema_linear_reverse_parallel(values, times, tau, num_threads));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_ema_next_reverse_parallel
+Rcpp::NumericVector Rcpp_wrapper_ema_next_reverse_parallel(const Rcpp::NumericVector& values, const Rcpp::DatetimeVector& times, double tau, int num_threads);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_ema_next_reverse_parallel(SEXP valuesSEXP, SEXP timesSEXP, SEXP tauSEXP, SEXP num_threadsSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const Rcpp::NumericVector& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::DatetimeVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< double >::type tau(tauSEXP);
+    Rcpp::traits::input_parameter< int >::type num_threads(num_threadsSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_ema_next_reverse_parallel(values, times, tau, num_threads));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_kernel_stats_enabled
+bool Rcpp_wrapper_kernel_stats_enabled();
+RcppExport SEXP _utsOperators_Rcpp_wrapper_kernel_stats_enabled() {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_kernel_stats_enabled());
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_kernel_stats_reset
+void Rcpp_wrapper_kernel_stats_reset();
+RcppExport SEXP _utsOperators_Rcpp_wrapper_kernel_stats_reset() {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp_wrapper_kernel_stats_reset();
+    return R_NilValue;
+END_RCPP
+}
+// Rcpp_wrapper_kernel_stats
+Rcpp::List Rcpp_wrapper_kernel_stats();
+RcppExport SEXP _utsOperators_Rcpp_wrapper_kernel_stats() {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_kernel_stats());
+    return rcpp_result_gen;
+END_RCPP
+}
 // Rcpp_wrapper_rolling_central_moment
 Rcpp::NumericVector Rcpp_wrapper_rolling_central_moment(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times, double width_before, double width_after, double m);
 RcppExport SEXP _utsOperators_Rcpp_wrapper_rolling_central_moment(SEXP valuesSEXP, SEXP timesSEXP, SEXP width_beforeSEXP, SEXP width_afterSEXP, SEXP mSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
-    Rcpp::traits::input_parameter< Rcpp::NumericVector& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< Rcpp::NumericVector& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< Rcpp::DatetimeVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< double >::type width_before(width_beforeSEXP);
+    Rcpp::traits::input_parameter< double >::type width_after(width_afterSEXP);
+    Rcpp::traits::input_parameter< double >::type m(mSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_rolling_central_moment(values, times, width_before, width_after, m));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_rolling_kurtosis
+Rcpp::NumericVector Rcpp_wrapper_rolling_kurtosis(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times, double width_before, double width_after);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_rolling_kurtosis(SEXP valuesSEXP, SEXP timesSEXP, SEXP width_beforeSEXP, SEXP width_afterSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::NumericVector& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< Rcpp::DatetimeVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< double >::type width_before(width_beforeSEXP);
+    Rcpp::traits::input_parameter< double >::type width_after(width_afterSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_rolling_kurtosis(values, times, width_before, width_after));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_rolling_log_product
+Rcpp::NumericVector Rcpp_wrapper_rolling_log_product(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times, double width_before, double width_after);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_rolling_log_product(SEXP valuesSEXP, SEXP timesSEXP, SEXP width_beforeSEXP, SEXP width_afterSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::NumericVector& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< Rcpp::DatetimeVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< double >::type width_before(width_beforeSEXP);
+    Rcpp::traits::input_parameter< double >::type width_after(width_afterSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_rolling_log_product(values, times, width_before, width_after));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_rolling_max
+Rcpp::NumericVector Rcpp_wrapper_rolling_max(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times, double width_before, double width_after);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_rolling_max(SEXP valuesSEXP, SEXP timesSEXP, SEXP width_beforeSEXP, SEXP width_afterSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::NumericVector& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< Rcpp::DatetimeVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< double >::type width_before(width_beforeSEXP);
+    Rcpp::traits::input_parameter< double >::type width_after(width_afterSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_rolling_max(values, times, width_before, width_after));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_rolling_mean
+Rcpp::NumericVector Rcpp_wrapper_rolling_mean(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times, double width_before, double width_after);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_rolling_mean(SEXP valuesSEXP, SEXP timesSEXP, SEXP width_beforeSEXP, SEXP width_afterSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::NumericVector& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< Rcpp::DatetimeVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< double >::type width_before(width_beforeSEXP);
+    Rcpp::traits::input_parameter< double >::type width_after(width_afterSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_rolling_mean(values, times, width_before, width_after));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_rolling_median
+Rcpp::NumericVector Rcpp_wrapper_rolling_median(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times, double width_before, double width_after);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_rolling_median(SEXP valuesSEXP, SEXP timesSEXP, SEXP width_beforeSEXP, SEXP width_afterSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::NumericVector& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< Rcpp::DatetimeVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< double >::type width_before(width_beforeSEXP);
+    Rcpp::traits::input_parameter< double >::type width_after(width_afterSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_rolling_median(values, times, width_before, width_after));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_rolling_min
+Rcpp::NumericVector Rcpp_wrapper_rolling_min(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times, double width_before, double width_after);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_rolling_min(SEXP valuesSEXP, SEXP timesSEXP, SEXP width_beforeSEXP, SEXP width_afterSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::NumericVector& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< Rcpp::DatetimeVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< double >::type width_before(width_beforeSEXP);
+    Rcpp::traits::input_parameter< double >::type width_after(width_afterSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_rolling_min(values, times, width_before, width_after));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_rolling_num_obs
+Rcpp::NumericVector Rcpp_wrapper_rolling_num_obs(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times, double width_before, double width_after);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_rolling_num_obs(SEXP valuesSEXP, SEXP timesSEXP, SEXP width_beforeSEXP, SEXP width_afterSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::NumericVector& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< Rcpp::DatetimeVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< double >::type width_before(width_beforeSEXP);
+    Rcpp::traits::input_parameter< double >::type width_after(width_afterSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_rolling_num_obs(values, times, width_before, width_after));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_rolling_product
+Rcpp::NumericVector Rcpp_wrapper_rolling_product(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times, double width_before, double width_after);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_rolling_product(SEXP valuesSEXP, SEXP timesSEXP, SEXP width_beforeSEXP, SEXP width_afterSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::NumericVector& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< Rcpp::DatetimeVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< double >::type width_before(width_beforeSEXP);
+    Rcpp::traits::input_parameter< double >::type width_after(width_afterSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_rolling_product(values, times, width_before, width_after));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_rolling_quantile
+Rcpp::NumericMatrix Rcpp_wrapper_rolling_quantile(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times, double width_before, double width_after, Rcpp::NumericVector& probs);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_rolling_quantile(SEXP valuesSEXP, SEXP timesSEXP, SEXP width_beforeSEXP, SEXP width_afterSEXP, SEXP probsSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::NumericVector& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< Rcpp::DatetimeVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< double >::type width_before(width_beforeSEXP);
+    Rcpp::traits::input_parameter< double >::type width_after(width_afterSEXP);
+    Rcpp::traits::input_parameter< Rcpp::NumericVector& >::type probs(probsSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_rolling_quantile(values, times, width_before, width_after, probs));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_rolling_sd
+Rcpp::NumericVector Rcpp_wrapper_rolling_sd(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times, double width_before, double width_after);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_rolling_sd(SEXP valuesSEXP, SEXP timesSEXP, SEXP width_beforeSEXP, SEXP width_afterSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::NumericVector& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< Rcpp::DatetimeVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< double >::type width_before(width_beforeSEXP);
+    Rcpp::traits::input_parameter< double >::type width_after(width_afterSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_rolling_sd(values, times, width_before, width_after));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_rolling_skewness
+Rcpp::NumericVector Rcpp_wrapper_rolling_skewness(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times, double width_before, double width_after);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_rolling_skewness(SEXP valuesSEXP, SEXP timesSEXP, SEXP width_beforeSEXP, SEXP width_afterSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::NumericVector& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< Rcpp::DatetimeVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< double >::type width_before(width_beforeSEXP);
+    Rcpp::traits::input_parameter< double >::type width_after(width_afterSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_rolling_skewness(values, times, width_before, width_after));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_rolling_sum
+Rcpp::NumericVector Rcpp_wrapper_rolling_sum(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times, double width_before, double width_after);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_rolling_sum(SEXP valuesSEXP, SEXP timesSEXP, SEXP width_beforeSEXP, SEXP width_afterSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::NumericVector& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< Rcpp::DatetimeVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< double >::type width_before(width_beforeSEXP);
+    Rcpp::traits::input_parameter< double >::type width_after(width_afterSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_rolling_sum(values, times, width_before, width_after));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_rolling_sum_exact
+Rcpp::NumericVector Rcpp_wrapper_rolling_sum_exact(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times, double width_before, double width_after);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_rolling_sum_exact(SEXP valuesSEXP, SEXP timesSEXP, SEXP width_beforeSEXP, SEXP width_afterSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::NumericVector& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< Rcpp::DatetimeVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< double >::type width_before(width_beforeSEXP);
+    Rcpp::traits::input_parameter< double >::type width_after(width_afterSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_rolling_sum_exact(values, times, width_before, width_after));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_rolling_sum_neumaier
+Rcpp::NumericVector Rcpp_wrapper_rolling_sum_neumaier(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times, double width_before, double width_after);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_rolling_sum_neumaier(SEXP valuesSEXP, SEXP timesSEXP, SEXP width_beforeSEXP, SEXP width_afterSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::NumericVector& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< Rcpp::DatetimeVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< double >::type width_before(width_beforeSEXP);
+    Rcpp::traits::input_parameter< double >::type width_after(width_afterSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_rolling_sum_neumaier(values, times, width_before, width_after));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_rolling_sum_stable
+Rcpp::NumericVector Rcpp_wrapper_rolling_sum_stable(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times, double width_before, double width_after);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_rolling_sum_stable(SEXP valuesSEXP, SEXP timesSEXP, SEXP width_beforeSEXP, SEXP width_afterSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::NumericVector& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< Rcpp::DatetimeVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< double >::type width_before(width_beforeSEXP);
+    Rcpp::traits::input_parameter< double >::type width_after(width_afterSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_rolling_sum_stable(values, times, width_before, width_after));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_rolling_var
+Rcpp::NumericVector Rcpp_wrapper_rolling_var(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times, double width_before, double width_after);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_rolling_var(SEXP valuesSEXP, SEXP timesSEXP, SEXP width_beforeSEXP, SEXP width_afterSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::NumericVector& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< Rcpp::DatetimeVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< double >::type width_before(width_beforeSEXP);
+    Rcpp::traits::input_parameter< double >::type width_after(width_afterSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_rolling_var(values, times, width_before, width_after));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_rolling_max_batch
+Rcpp::NumericMatrix Rcpp_wrapper_rolling_max_batch(Rcpp::NumericMatrix& values, Rcpp::DatetimeVector& times, double width_before, double width_after);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_rolling_max_batch(SEXP valuesSEXP, SEXP timesSEXP, SEXP width_beforeSEXP, SEXP width_afterSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::NumericMatrix& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< Rcpp::DatetimeVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< double >::type width_before(width_beforeSEXP);
+    Rcpp::traits::input_parameter< double >::type width_after(width_afterSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_rolling_max_batch(values, times, width_before, width_after));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_rolling_mean_batch
+Rcpp::NumericMatrix Rcpp_wrapper_rolling_mean_batch(Rcpp::NumericMatrix& values, Rcpp::DatetimeVector& times, double width_before, double width_after);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_rolling_mean_batch(SEXP valuesSEXP, SEXP timesSEXP, SEXP width_beforeSEXP, SEXP width_afterSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::NumericMatrix& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< Rcpp::DatetimeVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< double >::type width_before(width_beforeSEXP);
+    Rcpp::traits::input_parameter< double >::type width_after(width_afterSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_rolling_mean_batch(values, times, width_before, width_after));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_rolling_min_batch
+Rcpp::NumericMatrix Rcpp_wrapper_rolling_min_batch(Rcpp::NumericMatrix& values, Rcpp::DatetimeVector& times, double width_before, double width_after);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_rolling_min_batch(SEXP valuesSEXP, SEXP timesSEXP, SEXP width_beforeSEXP, SEXP width_afterSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::NumericMatrix& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< Rcpp::DatetimeVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< double >::type width_before(width_beforeSEXP);
+    Rcpp::traits::input_parameter< double >::type width_after(width_afterSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_rolling_min_batch(values, times, width_before, width_after));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_rolling_sd_batch
+Rcpp::NumericMatrix Rcpp_wrapper_rolling_sd_batch(Rcpp::NumericMatrix& values, Rcpp::DatetimeVector& times, double width_before, double width_after);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_rolling_sd_batch(SEXP valuesSEXP, SEXP timesSEXP, SEXP width_beforeSEXP, SEXP width_afterSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::NumericMatrix& >::type values(valuesSEXP);
     Rcpp::traits::input_parameter< Rcpp::DatetimeVector& >::type times(timesSEXP);
     Rcpp::traits::input_parameter< double >::type width_before(width_beforeSEXP);
     Rcpp::traits::input_parameter< double >::type width_after(width_afterSEXP);
-    Rcpp::traits::input_parameter< double >::type m(mSEXP);
-    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_rolling_central_moment(values, times, width_before, width_after, m));
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_rolling_sd_batch(values, times, width_before, width_after));
     return rcpp_result_gen;
 END_RCPP
 }
-// Rcpp_wrapper_rolling_max
-Rcpp::NumericVector Rcpp_wrapper_rolling_max(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times, double width_before, double width_after);
-RcppExport SEXP _utsOperators_Rcpp_wrapper_rolling_max(SEXP valuesSEXP, SEXP timesSEXP, SEXP width_beforeSEXP, SEXP width_afterSEXP) {
+// Rcpp_wrapper_rolling_sum_batch
+Rcpp::NumericMatrix Rcpp_wrapper_rolling_sum_batch(Rcpp::NumericMatrix& values, Rcpp::DatetimeVector& times, double width_before, double width_after);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_rolling_sum_batch(SEXP valuesSEXP, SEXP timesSEXP, SEXP width_beforeSEXP, SEXP width_afterSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
-    Rcpp::traits::input_parameter< Rcpp::NumericVector& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< Rcpp::NumericMatrix& >::type values(valuesSEXP);
     Rcpp::traits::input_parameter< Rcpp::DatetimeVector& >::type times(timesSEXP);
     Rcpp::traits::input_parameter< double >::type width_before(width_beforeSEXP);
     Rcpp::traits::input_parameter< double >::type width_after(width_afterSEXP);
-    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_rolling_max(values, times, width_before, width_after));
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_rolling_sum_batch(values, times, width_before, width_after));
     return rcpp_result_gen;
 END_RCPP
 }
-// Rcpp_wrapper_rolling_mean
-Rcpp::NumericVector Rcpp_wrapper_rolling_mean(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times, double width_before, double width_after);
-RcppExport SEXP _utsOperators_Rcpp_wrapper_rolling_mean(SEXP valuesSEXP, SEXP timesSEXP, SEXP width_beforeSEXP, SEXP width_afterSEXP) {
+// Rcpp_wrapper_rolling_var_batch
+Rcpp::NumericMatrix Rcpp_wrapper_rolling_var_batch(Rcpp::NumericMatrix& values, Rcpp::DatetimeVector& times, double width_before, double width_after);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_rolling_var_batch(SEXP valuesSEXP, SEXP timesSEXP, SEXP width_beforeSEXP, SEXP width_afterSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
-    Rcpp::traits::input_parameter< Rcpp::NumericVector& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< Rcpp::NumericMatrix& >::type values(valuesSEXP);
     Rcpp::traits::input_parameter< Rcpp::DatetimeVector& >::type times(timesSEXP);
     Rcpp::traits::input_parameter< double >::type width_before(width_beforeSEXP);
     Rcpp::traits::input_parameter< double >::type width_after(width_afterSEXP);
-    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_rolling_mean(values, times, width_before, width_after));
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_rolling_var_batch(values, times, width_before, width_after));
     return rcpp_result_gen;
 END_RCPP
 }
-// Rcpp_wrapper_rolling_median
-Rcpp::NumericVector Rcpp_wrapper_rolling_median(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times, double width_before, double width_after);
-RcppExport SEXP _utsOperators_Rcpp_wrapper_rolling_median(SEXP valuesSEXP, SEXP timesSEXP, SEXP width_beforeSEXP, SEXP width_afterSEXP) {
+// Rcpp_wrapper_rolling_max_parallel
+Rcpp::NumericVector Rcpp_wrapper_rolling_max_parallel(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times, double width_before, double width_after, int num_threads, int min_chunk);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_rolling_max_parallel(SEXP valuesSEXP, SEXP timesSEXP, SEXP width_beforeSEXP, SEXP width_afterSEXP, SEXP num_threadsSEXP, SEXP min_chunkSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
@@ -97,13 +719,15 @@ BEGIN_RCPP
     Rcpp::traits::input_parameter< Rcpp::DatetimeVector& >::type times(timesSEXP);
     Rcpp::traits::input_parameter< double >::type width_before(width_beforeSEXP);
     Rcpp::traits::input_parameter< double >::type width_after(width_afterSEXP);
-    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_rolling_median(values, times, width_before, width_after));
+    Rcpp::traits::input_parameter< int >::type num_threads(num_threadsSEXP);
+    Rcpp::traits::input_parameter< int >::type min_chunk(min_chunkSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_rolling_max_parallel(values, times, width_before, width_after, num_threads, min_chunk));
     return rcpp_result_gen;
 END_RCPP
 }
-// Rcpp_wrapper_rolling_min
-Rcpp::NumericVector Rcpp_wrapper_rolling_min(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times, double width_before, double width_after);
-RcppExport SEXP _utsOperators_Rcpp_wrapper_rolling_min(SEXP valuesSEXP, SEXP timesSEXP, SEXP width_beforeSEXP, SEXP width_afterSEXP) {
+// Rcpp_wrapper_rolling_mean_parallel
+Rcpp::NumericVector Rcpp_wrapper_rolling_mean_parallel(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times, double width_before, double width_after, int num_threads, int min_chunk);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_rolling_mean_parallel(SEXP valuesSEXP, SEXP timesSEXP, SEXP width_beforeSEXP, SEXP width_afterSEXP, SEXP num_threadsSEXP, SEXP min_chunkSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
@@ -111,13 +735,15 @@ BEGIN_RCPP
     Rcpp::traits::input_parameter< Rcpp::DatetimeVector& >::type times(timesSEXP);
     Rcpp::traits::input_parameter< double >::type width_before(width_beforeSEXP);
     Rcpp::traits::input_parameter< double >::type width_after(width_afterSEXP);
-    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_rolling_min(values, times, width_before, width_after));
+    Rcpp::traits::input_parameter< int >::type num_threads(num_threadsSEXP);
+    Rcpp::traits::input_parameter< int >::type min_chunk(min_chunkSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_rolling_mean_parallel(values, times, width_before, width_after, num_threads, min_chunk));
     return rcpp_result_gen;
 END_RCPP
 }
-// Rcpp_wrapper_rolling_num_obs
-Rcpp::NumericVector Rcpp_wrapper_rolling_num_obs(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times, double width_before, double width_after);
-RcppExport SEXP _utsOperators_Rcpp_wrapper_rolling_num_obs(SEXP valuesSEXP, SEXP timesSEXP, SEXP width_beforeSEXP, SEXP width_afterSEXP) {
+// Rcpp_wrapper_rolling_min_parallel
+Rcpp::NumericVector Rcpp_wrapper_rolling_min_parallel(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times, double width_before, double width_after, int num_threads, int min_chunk);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_rolling_min_parallel(SEXP valuesSEXP, SEXP timesSEXP, SEXP width_beforeSEXP, SEXP width_afterSEXP, SEXP num_threadsSEXP, SEXP min_chunkSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
@@ -125,13 +751,15 @@ BEGIN_RCPP
     Rcpp::traits::input_parameter< Rcpp::DatetimeVector& >::type times(timesSEXP);
     Rcpp::traits::input_parameter< double >::type width_before(width_beforeSEXP);
     Rcpp::traits::input_parameter< double >::type width_after(width_afterSEXP);
-    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_rolling_num_obs(values, times, width_before, width_after));
+    Rcpp::traits::input_parameter< int >::type num_threads(num_threadsSEXP);
+    Rcpp::traits::input_parameter< int >::type min_chunk(min_chunkSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_rolling_min_parallel(values, times, width_before, width_after, num_threads, min_chunk));
     return rcpp_result_gen;
 END_RCPP
 }
-// Rcpp_wrapper_rolling_product
-Rcpp::NumericVector Rcpp_wrapper_rolling_product(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times, double width_before, double width_after);
-RcppExport SEXP _utsOperators_Rcpp_wrapper_rolling_product(SEXP valuesSEXP, SEXP timesSEXP, SEXP width_beforeSEXP, SEXP width_afterSEXP) {
+// Rcpp_wrapper_rolling_num_obs_parallel
+Rcpp::NumericVector Rcpp_wrapper_rolling_num_obs_parallel(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times, double width_before, double width_after, int num_threads, int min_chunk);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_rolling_num_obs_parallel(SEXP valuesSEXP, SEXP timesSEXP, SEXP width_beforeSEXP, SEXP width_afterSEXP, SEXP num_threadsSEXP, SEXP min_chunkSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
@@ -139,13 +767,15 @@ BEGIN_RCPP
     Rcpp::traits::input_parameter< Rcpp::DatetimeVector& >::type times(timesSEXP);
     Rcpp::traits::input_parameter< double >::type width_before(width_beforeSEXP);
     Rcpp::traits::input_parameter< double >::type width_after(width_afterSEXP);
-    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_rolling_product(values, times, width_before, width_after));
+    Rcpp::traits::input_parameter< int >::type num_threads(num_threadsSEXP);
+    Rcpp::traits::input_parameter< int >::type min_chunk(min_chunkSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_rolling_num_obs_parallel(values, times, width_before, width_after, num_threads, min_chunk));
     return rcpp_result_gen;
 END_RCPP
 }
-// Rcpp_wrapper_rolling_sd
-Rcpp::NumericVector Rcpp_wrapper_rolling_sd(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times, double width_before, double width_after);
-RcppExport SEXP _utsOperators_Rcpp_wrapper_rolling_sd(SEXP valuesSEXP, SEXP timesSEXP, SEXP width_beforeSEXP, SEXP width_afterSEXP) {
+// Rcpp_wrapper_rolling_sum_parallel
+Rcpp::NumericVector Rcpp_wrapper_rolling_sum_parallel(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times, double width_before, double width_after, int num_threads, int min_chunk);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_rolling_sum_parallel(SEXP valuesSEXP, SEXP timesSEXP, SEXP width_beforeSEXP, SEXP width_afterSEXP, SEXP num_threadsSEXP, SEXP min_chunkSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
@@ -153,41 +783,127 @@ BEGIN_RCPP
     Rcpp::traits::input_parameter< Rcpp::DatetimeVector& >::type times(timesSEXP);
     Rcpp::traits::input_parameter< double >::type width_before(width_beforeSEXP);
     Rcpp::traits::input_parameter< double >::type width_after(width_afterSEXP);
-    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_rolling_sd(values, times, width_before, width_after));
+    Rcpp::traits::input_parameter< int >::type num_threads(num_threadsSEXP);
+    Rcpp::traits::input_parameter< int >::type min_chunk(min_chunkSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_rolling_sum_parallel(values, times, width_before, width_after, num_threads, min_chunk));
     return rcpp_result_gen;
 END_RCPP
 }
-// Rcpp_wrapper_rolling_sum
-Rcpp::NumericVector Rcpp_wrapper_rolling_sum(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times, double width_before, double width_after);
-RcppExport SEXP _utsOperators_Rcpp_wrapper_rolling_sum(SEXP valuesSEXP, SEXP timesSEXP, SEXP width_beforeSEXP, SEXP width_afterSEXP) {
+// Rcpp_wrapper_rolling_static_max
+Rcpp::NumericVector Rcpp_wrapper_rolling_static_max(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times, Rcpp::DatetimeVector& start_times, Rcpp::DatetimeVector& end_times);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_rolling_static_max(SEXP valuesSEXP, SEXP timesSEXP, SEXP start_timesSEXP, SEXP end_timesSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
     Rcpp::traits::input_parameter< Rcpp::NumericVector& >::type values(valuesSEXP);
     Rcpp::traits::input_parameter< Rcpp::DatetimeVector& >::type times(timesSEXP);
-    Rcpp::traits::input_parameter< double >::type width_before(width_beforeSEXP);
-    Rcpp::traits::input_parameter< double >::type width_after(width_afterSEXP);
-    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_rolling_sum(values, times, width_before, width_after));
+    Rcpp::traits::input_parameter< Rcpp::DatetimeVector& >::type start_times(start_timesSEXP);
+    Rcpp::traits::input_parameter< Rcpp::DatetimeVector& >::type end_times(end_timesSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_rolling_static_max(values, times, start_times, end_times));
     return rcpp_result_gen;
 END_RCPP
 }
-// Rcpp_wrapper_rolling_sum_stable
-Rcpp::NumericVector Rcpp_wrapper_rolling_sum_stable(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times, double width_before, double width_after);
-RcppExport SEXP _utsOperators_Rcpp_wrapper_rolling_sum_stable(SEXP valuesSEXP, SEXP timesSEXP, SEXP width_beforeSEXP, SEXP width_afterSEXP) {
+// Rcpp_wrapper_rolling_static_mean
+Rcpp::NumericVector Rcpp_wrapper_rolling_static_mean(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times, Rcpp::DatetimeVector& start_times, Rcpp::DatetimeVector& end_times);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_rolling_static_mean(SEXP valuesSEXP, SEXP timesSEXP, SEXP start_timesSEXP, SEXP end_timesSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
     Rcpp::traits::input_parameter< Rcpp::NumericVector& >::type values(valuesSEXP);
     Rcpp::traits::input_parameter< Rcpp::DatetimeVector& >::type times(timesSEXP);
-    Rcpp::traits::input_parameter< double >::type width_before(width_beforeSEXP);
-    Rcpp::traits::input_parameter< double >::type width_after(width_afterSEXP);
-    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_rolling_sum_stable(values, times, width_before, width_after));
+    Rcpp::traits::input_parameter< Rcpp::DatetimeVector& >::type start_times(start_timesSEXP);
+    Rcpp::traits::input_parameter< Rcpp::DatetimeVector& >::type end_times(end_timesSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_rolling_static_mean(values, times, start_times, end_times));
     return rcpp_result_gen;
 END_RCPP
 }
-// Rcpp_wrapper_rolling_var
-Rcpp::NumericVector Rcpp_wrapper_rolling_var(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times, double width_before, double width_after);
-RcppExport SEXP _utsOperators_Rcpp_wrapper_rolling_var(SEXP valuesSEXP, SEXP timesSEXP, SEXP width_beforeSEXP, SEXP width_afterSEXP) {
+// Rcpp_wrapper_rolling_static_median
+Rcpp::NumericVector Rcpp_wrapper_rolling_static_median(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times, Rcpp::DatetimeVector& start_times, Rcpp::DatetimeVector& end_times);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_rolling_static_median(SEXP valuesSEXP, SEXP timesSEXP, SEXP start_timesSEXP, SEXP end_timesSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::NumericVector& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< Rcpp::DatetimeVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< Rcpp::DatetimeVector& >::type start_times(start_timesSEXP);
+    Rcpp::traits::input_parameter< Rcpp::DatetimeVector& >::type end_times(end_timesSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_rolling_static_median(values, times, start_times, end_times));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_rolling_static_min
+Rcpp::NumericVector Rcpp_wrapper_rolling_static_min(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times, Rcpp::DatetimeVector& start_times, Rcpp::DatetimeVector& end_times);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_rolling_static_min(SEXP valuesSEXP, SEXP timesSEXP, SEXP start_timesSEXP, SEXP end_timesSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::NumericVector& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< Rcpp::DatetimeVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< Rcpp::DatetimeVector& >::type start_times(start_timesSEXP);
+    Rcpp::traits::input_parameter< Rcpp::DatetimeVector& >::type end_times(end_timesSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_rolling_static_min(values, times, start_times, end_times));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_rolling_static_num_obs
+Rcpp::NumericVector Rcpp_wrapper_rolling_static_num_obs(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times, Rcpp::DatetimeVector& start_times, Rcpp::DatetimeVector& end_times);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_rolling_static_num_obs(SEXP valuesSEXP, SEXP timesSEXP, SEXP start_timesSEXP, SEXP end_timesSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::NumericVector& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< Rcpp::DatetimeVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< Rcpp::DatetimeVector& >::type start_times(start_timesSEXP);
+    Rcpp::traits::input_parameter< Rcpp::DatetimeVector& >::type end_times(end_timesSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_rolling_static_num_obs(values, times, start_times, end_times));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_rolling_static_product
+Rcpp::NumericVector Rcpp_wrapper_rolling_static_product(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times, Rcpp::DatetimeVector& start_times, Rcpp::DatetimeVector& end_times);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_rolling_static_product(SEXP valuesSEXP, SEXP timesSEXP, SEXP start_timesSEXP, SEXP end_timesSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::NumericVector& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< Rcpp::DatetimeVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< Rcpp::DatetimeVector& >::type start_times(start_timesSEXP);
+    Rcpp::traits::input_parameter< Rcpp::DatetimeVector& >::type end_times(end_timesSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_rolling_static_product(values, times, start_times, end_times));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_rolling_static_sum
+Rcpp::NumericVector Rcpp_wrapper_rolling_static_sum(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times, Rcpp::DatetimeVector& start_times, Rcpp::DatetimeVector& end_times);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_rolling_static_sum(SEXP valuesSEXP, SEXP timesSEXP, SEXP start_timesSEXP, SEXP end_timesSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::NumericVector& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< Rcpp::DatetimeVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< Rcpp::DatetimeVector& >::type start_times(start_timesSEXP);
+    Rcpp::traits::input_parameter< Rcpp::DatetimeVector& >::type end_times(end_timesSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_rolling_static_sum(values, times, start_times, end_times));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_rolling_static_var
+Rcpp::NumericVector Rcpp_wrapper_rolling_static_var(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times, Rcpp::DatetimeVector& start_times, Rcpp::DatetimeVector& end_times);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_rolling_static_var(SEXP valuesSEXP, SEXP timesSEXP, SEXP start_timesSEXP, SEXP end_timesSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< Rcpp::NumericVector& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< Rcpp::DatetimeVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< Rcpp::DatetimeVector& >::type start_times(start_timesSEXP);
+    Rcpp::traits::input_parameter< Rcpp::DatetimeVector& >::type end_times(end_timesSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_rolling_static_var(values, times, start_times, end_times));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_rolling_summary
+Rcpp::NumericMatrix Rcpp_wrapper_rolling_summary(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times, double width_before, double width_after, Rcpp::IntegerVector& stats);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_rolling_summary(SEXP valuesSEXP, SEXP timesSEXP, SEXP width_beforeSEXP, SEXP width_afterSEXP, SEXP statsSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::RNGScope rcpp_rngScope_gen;
@@ -195,7 +911,8 @@ BEGIN_RCPP
     Rcpp::traits::input_parameter< Rcpp::DatetimeVector& >::type times(timesSEXP);
     Rcpp::traits::input_parameter< double >::type width_before(width_beforeSEXP);
     Rcpp::traits::input_parameter< double >::type width_after(width_afterSEXP);
-    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_rolling_var(values, times, width_before, width_after));
+    Rcpp::traits::input_parameter< Rcpp::IntegerVector& >::type stats(statsSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_rolling_summary(values, times, width_before, width_after, stats));
     return rcpp_result_gen;
 END_RCPP
 }
@@ -241,25 +958,380 @@ BEGIN_RCPP
     return rcpp_result_gen;
 END_RCPP
 }
+// Rcpp_wrapper_sma_last_batch
+Rcpp::NumericMatrix Rcpp_wrapper_sma_last_batch(const Rcpp::NumericMatrix& values, const Rcpp::DatetimeVector& times, double width_before, double width_after);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_sma_last_batch(SEXP valuesSEXP, SEXP timesSEXP, SEXP width_beforeSEXP, SEXP width_afterSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const Rcpp::NumericMatrix& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::DatetimeVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< double >::type width_before(width_beforeSEXP);
+    Rcpp::traits::input_parameter< double >::type width_after(width_afterSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_sma_last_batch(values, times, width_before, width_after));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_sma_linear_batch
+Rcpp::NumericMatrix Rcpp_wrapper_sma_linear_batch(const Rcpp::NumericMatrix& values, const Rcpp::DatetimeVector& times, double width_before, double width_after);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_sma_linear_batch(SEXP valuesSEXP, SEXP timesSEXP, SEXP width_beforeSEXP, SEXP width_afterSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const Rcpp::NumericMatrix& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::DatetimeVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< double >::type width_before(width_beforeSEXP);
+    Rcpp::traits::input_parameter< double >::type width_after(width_afterSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_sma_linear_batch(values, times, width_before, width_after));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_sma_next_batch
+Rcpp::NumericMatrix Rcpp_wrapper_sma_next_batch(const Rcpp::NumericMatrix& values, const Rcpp::DatetimeVector& times, double width_before, double width_after);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_sma_next_batch(SEXP valuesSEXP, SEXP timesSEXP, SEXP width_beforeSEXP, SEXP width_afterSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const Rcpp::NumericMatrix& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::DatetimeVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< double >::type width_before(width_beforeSEXP);
+    Rcpp::traits::input_parameter< double >::type width_after(width_afterSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_sma_next_batch(values, times, width_before, width_after));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_sma_last_parallel
+Rcpp::NumericVector Rcpp_wrapper_sma_last_parallel(const Rcpp::NumericVector& values, const Rcpp::DatetimeVector& times, double width_before, double width_after, int num_threads, int min_chunk);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_sma_last_parallel(SEXP valuesSEXP, SEXP timesSEXP, SEXP width_beforeSEXP, SEXP width_afterSEXP, SEXP num_threadsSEXP, SEXP min_chunkSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const Rcpp::NumericVector& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::DatetimeVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< double >::type width_before(width_beforeSEXP);
+    Rcpp::traits::input_parameter< double >::type width_after(width_afterSEXP);
+    Rcpp::traits::input_parameter< int >::type num_threads(num_threadsSEXP);
+    Rcpp::traits::input_parameter< int >::type min_chunk(min_chunkSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_sma_last_parallel(values, times, width_before, width_after, num_threads, min_chunk));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_sma_linear_parallel
+Rcpp::NumericVector Rcpp_wrapper_sma_linear_parallel(const Rcpp::NumericVector& values, const Rcpp::DatetimeVector& times, double width_before, double width_after, int num_threads, int min_chunk);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_sma_linear_parallel(SEXP valuesSEXP, SEXP timesSEXP, SEXP width_beforeSEXP, SEXP width_afterSEXP, SEXP num_threadsSEXP, SEXP min_chunkSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const Rcpp::NumericVector& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::DatetimeVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< double >::type width_before(width_beforeSEXP);
+    Rcpp::traits::input_parameter< double >::type width_after(width_afterSEXP);
+    Rcpp::traits::input_parameter< int >::type num_threads(num_threadsSEXP);
+    Rcpp::traits::input_parameter< int >::type min_chunk(min_chunkSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_sma_linear_parallel(values, times, width_before, width_after, num_threads, min_chunk));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_sma_next_parallel
+Rcpp::NumericVector Rcpp_wrapper_sma_next_parallel(const Rcpp::NumericVector& values, const Rcpp::DatetimeVector& times, double width_before, double width_after, int num_threads, int min_chunk);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_sma_next_parallel(SEXP valuesSEXP, SEXP timesSEXP, SEXP width_beforeSEXP, SEXP width_afterSEXP, SEXP num_threadsSEXP, SEXP min_chunkSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const Rcpp::NumericVector& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::DatetimeVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< double >::type width_before(width_beforeSEXP);
+    Rcpp::traits::input_parameter< double >::type width_after(width_afterSEXP);
+    Rcpp::traits::input_parameter< int >::type num_threads(num_threadsSEXP);
+    Rcpp::traits::input_parameter< int >::type min_chunk(min_chunkSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_sma_next_parallel(values, times, width_before, width_after, num_threads, min_chunk));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_sma_last_query
+Rcpp::NumericVector Rcpp_wrapper_sma_last_query(const Rcpp::NumericVector& values, const Rcpp::DatetimeVector& times, double width_before, double width_after, const Rcpp::DatetimeVector& query_times);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_sma_last_query(SEXP valuesSEXP, SEXP timesSEXP, SEXP width_beforeSEXP, SEXP width_afterSEXP, SEXP query_timesSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const Rcpp::NumericVector& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::DatetimeVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< double >::type width_before(width_beforeSEXP);
+    Rcpp::traits::input_parameter< double >::type width_after(width_afterSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::DatetimeVector& >::type query_times(query_timesSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_sma_last_query(values, times, width_before, width_after, query_times));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_sma_linear_query
+Rcpp::NumericVector Rcpp_wrapper_sma_linear_query(const Rcpp::NumericVector& values, const Rcpp::DatetimeVector& times, double width_before, double width_after, const Rcpp::DatetimeVector& query_times);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_sma_linear_query(SEXP valuesSEXP, SEXP timesSEXP, SEXP width_beforeSEXP, SEXP width_afterSEXP, SEXP query_timesSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const Rcpp::NumericVector& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::DatetimeVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< double >::type width_before(width_beforeSEXP);
+    Rcpp::traits::input_parameter< double >::type width_after(width_afterSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::DatetimeVector& >::type query_times(query_timesSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_sma_linear_query(values, times, width_before, width_after, query_times));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_sma_next_query
+Rcpp::NumericVector Rcpp_wrapper_sma_next_query(const Rcpp::NumericVector& values, const Rcpp::DatetimeVector& times, double width_before, double width_after, const Rcpp::DatetimeVector& query_times);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_sma_next_query(SEXP valuesSEXP, SEXP timesSEXP, SEXP width_beforeSEXP, SEXP width_afterSEXP, SEXP query_timesSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const Rcpp::NumericVector& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::DatetimeVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< double >::type width_before(width_beforeSEXP);
+    Rcpp::traits::input_parameter< double >::type width_after(width_afterSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::DatetimeVector& >::type query_times(query_timesSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_sma_next_query(values, times, width_before, width_after, query_times));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_streaming_ema_new
+SEXP Rcpp_wrapper_streaming_ema_new(double tau, std::string interpolation);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_streaming_ema_new(SEXP tauSEXP, SEXP interpolationSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< double >::type tau(tauSEXP);
+    Rcpp::traits::input_parameter< std::string >::type interpolation(interpolationSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_streaming_ema_new(tau, interpolation));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_streaming_sma_new
+SEXP Rcpp_wrapper_streaming_sma_new(double width, std::string interpolation);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_streaming_sma_new(SEXP widthSEXP, SEXP interpolationSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< double >::type width(widthSEXP);
+    Rcpp::traits::input_parameter< std::string >::type interpolation(interpolationSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_streaming_sma_new(width, interpolation));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_streaming_rolling_new
+SEXP Rcpp_wrapper_streaming_rolling_new(double width, std::string statistic);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_streaming_rolling_new(SEXP widthSEXP, SEXP statisticSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< double >::type width(widthSEXP);
+    Rcpp::traits::input_parameter< std::string >::type statistic(statisticSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_streaming_rolling_new(width, statistic));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_streaming_push
+Rcpp::NumericVector Rcpp_wrapper_streaming_push(SEXP op, const Rcpp::NumericVector& times, const Rcpp::NumericVector& values);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_streaming_push(SEXP opSEXP, SEXP timesSEXP, SEXP valuesSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< SEXP >::type op(opSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::NumericVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::NumericVector& >::type values(valuesSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_streaming_push(op, times, values));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_streaming_description
+std::string Rcpp_wrapper_streaming_description(SEXP op);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_streaming_description(SEXP opSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< SEXP >::type op(opSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_streaming_description(op));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_streaming_save
+Rcpp::RawVector Rcpp_wrapper_streaming_save(SEXP op);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_streaming_save(SEXP opSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< SEXP >::type op(opSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_streaming_save(op));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_streaming_restore
+SEXP Rcpp_wrapper_streaming_restore(const Rcpp::RawVector& state);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_streaming_restore(SEXP stateSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< const Rcpp::RawVector& >::type state(stateSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_streaming_restore(state));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_uts_file_write
+void Rcpp_wrapper_uts_file_write(std::string path, const Rcpp::NumericVector& times, const Rcpp::NumericMatrix& values, std::vector<std::string> names, bool append);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_uts_file_write(SEXP pathSEXP, SEXP timesSEXP, SEXP valuesSEXP, SEXP namesSEXP, SEXP appendSEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< std::string >::type path(pathSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::NumericVector& >::type times(timesSEXP);
+    Rcpp::traits::input_parameter< const Rcpp::NumericMatrix& >::type values(valuesSEXP);
+    Rcpp::traits::input_parameter< std::vector<std::string> >::type names(namesSEXP);
+    Rcpp::traits::input_parameter< bool >::type append(appendSEXP);
+    Rcpp_wrapper_uts_file_write(path, times, values, names, append);
+    return R_NilValue;
+END_RCPP
+}
+// Rcpp_wrapper_uts_file_info
+Rcpp::List Rcpp_wrapper_uts_file_info(std::string path);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_uts_file_info(SEXP pathSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< std::string >::type path(pathSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_uts_file_info(path));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_uts_file_read
+Rcpp::List Rcpp_wrapper_uts_file_read(std::string path, double start, double end);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_uts_file_read(SEXP pathSEXP, SEXP startSEXP, SEXP endSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< std::string >::type path(pathSEXP);
+    Rcpp::traits::input_parameter< double >::type start(startSEXP);
+    Rcpp::traits::input_parameter< double >::type end(endSEXP);
+    rcpp_result_gen = Rcpp::wrap(Rcpp_wrapper_uts_file_read(path, start, end));
+    return rcpp_result_gen;
+END_RCPP
+}
+// Rcpp_wrapper_uts_file_apply
+void Rcpp_wrapper_uts_file_apply(std::string path, std::string path_out, std::string C_fct, double width_before, double width_after);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_uts_file_apply(SEXP pathSEXP, SEXP path_outSEXP, SEXP C_fctSEXP, SEXP width_beforeSEXP, SEXP width_afterSEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< std::string >::type path(pathSEXP);
+    Rcpp::traits::input_parameter< std::string >::type path_out(path_outSEXP);
+    Rcpp::traits::input_parameter< std::string >::type C_fct(C_fctSEXP);
+    Rcpp::traits::input_parameter< double >::type width_before(width_beforeSEXP);
+    Rcpp::traits::input_parameter< double >::type width_after(width_afterSEXP);
+    Rcpp_wrapper_uts_file_apply(path, path_out, C_fct, width_before, width_after);
+    return R_NilValue;
+END_RCPP
+}
+// Rcpp_wrapper_uts_file_apply_ema
+void Rcpp_wrapper_uts_file_apply_ema(std::string path, std::string path_out, std::string C_fct, double tau);
+RcppExport SEXP _utsOperators_Rcpp_wrapper_uts_file_apply_ema(SEXP pathSEXP, SEXP path_outSEXP, SEXP C_fctSEXP, SEXP tauSEXP) {
+BEGIN_RCPP
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< std::string >::type path(pathSEXP);
+    Rcpp::traits::input_parameter< std::string >::type path_out(path_outSEXP);
+    Rcpp::traits::input_parameter< std::string >::type C_fct(C_fctSEXP);
+    Rcpp::traits::input_parameter< double >::type tau(tauSEXP);
+    Rcpp_wrapper_uts_file_apply_ema(path, path_out, C_fct, tau);
+    return R_NilValue;
+END_RCPP
+}
 
 static const R_CallMethodDef CallEntries[] = {
     {"_utsOperators_Rcpp_wrapper_ema_last", (DL_FUNC) &_utsOperators_Rcpp_wrapper_ema_last, 3},
     {"_utsOperators_Rcpp_wrapper_ema_linear", (DL_FUNC) &_utsOperators_Rcpp_wrapper_ema_linear, 3},
     {"_utsOperators_Rcpp_wrapper_ema_next", (DL_FUNC) &_utsOperators_Rcpp_wrapper_ema_next, 3},
+    {"_utsOperators_Rcpp_wrapper_ema_last_batch", (DL_FUNC) &_utsOperators_Rcpp_wrapper_ema_last_batch, 3},
+    {"_utsOperators_Rcpp_wrapper_ema_linear_batch", (DL_FUNC) &_utsOperators_Rcpp_wrapper_ema_linear_batch, 3},
+    {"_utsOperators_Rcpp_wrapper_ema_next_batch", (DL_FUNC) &_utsOperators_Rcpp_wrapper_ema_next_batch, 3},
+    {"_utsOperators_Rcpp_wrapper_ema_last_bank", (DL_FUNC) &_utsOperators_Rcpp_wrapper_ema_last_bank, 3},
+    {"_utsOperators_Rcpp_wrapper_ema_linear_bank", (DL_FUNC) &_utsOperators_Rcpp_wrapper_ema_linear_bank, 3},
+    {"_utsOperators_Rcpp_wrapper_ema_next_bank", (DL_FUNC) &_utsOperators_Rcpp_wrapper_ema_next_bank, 3},
+    {"_utsOperators_Rcpp_wrapper_ema_last_parallel", (DL_FUNC) &_utsOperators_Rcpp_wrapper_ema_last_parallel, 4},
+    {"_utsOperators_Rcpp_wrapper_ema_linear_parallel", (DL_FUNC) &_utsOperators_Rcpp_wrapper_ema_linear_parallel, 4},
+    {"_utsOperators_Rcpp_wrapper_ema_next_parallel", (DL_FUNC) &_utsOperators_Rcpp_wrapper_ema_next_parallel, 4},
+    {"_utsOperators_Rcpp_wrapper_ema_iterated", (DL_FUNC) &_utsOperators_Rcpp_wrapper_ema_iterated, 5},
+    {"_utsOperators_Rcpp_wrapper_ema_iterated_var", (DL_FUNC) &_utsOperators_Rcpp_wrapper_ema_iterated_var, 5},
+    {"_utsOperators_Rcpp_wrapper_ema_last_query", (DL_FUNC) &_utsOperators_Rcpp_wrapper_ema_last_query, 4},
+    {"_utsOperators_Rcpp_wrapper_ema_linear_query", (DL_FUNC) &_utsOperators_Rcpp_wrapper_ema_linear_query, 4},
+    {"_utsOperators_Rcpp_wrapper_ema_next_query", (DL_FUNC) &_utsOperators_Rcpp_wrapper_ema_next_query, 4},
+    {"_utsOperators_Rcpp_wrapper_ema_last_reverse", (DL_FUNC) &_utsOperators_Rcpp_wrapper_ema_last_reverse, 3},
+    {"_utsOperators_Rcpp_wrapper_ema_linear_reverse", (DL_FUNC) &_utsOperators_Rcpp_wrapper_ema_linear_reverse, 3},
+    {"_utsOperators_Rcpp_wrapper_ema_next_reverse", (DL_FUNC) &_utsOperators_Rcpp_wrapper_ema_next_reverse, 3},
+    {"_utsOperators_Rcpp_wrapper_ema_last_reverse_bank", (DL_FUNC) &_utsOperators_Rcpp_wrapper_ema_last_reverse_bank, 3},
+    {"_utsOperators_Rcpp_wrapper_ema_linear_reverse_bank", (DL_FUNC) &_utsOperators_Rcpp_wrapper_ema_linear_reverse_bank, 3},
+    {"_utsOperators_Rcpp_wrapper_ema_next_reverse_bank", (DL_FUNC) &_utsOperators_Rcpp_wrapper_ema_next_reverse_bank, 3},
+    {"_utsOperators_Rcpp_wrapper_ema_last_reverse_parallel", (DL_FUNC) &_utsOperators_Rcpp_wrapper_ema_last_reverse_parallel, 4},
+    {"_utsOperators_Rcpp_wrapper_ema_linear_reverse_parallel", (DL_FUNC) &_utsOperators_Rcpp_wrapper_ema_linear_reverse_parallel, 4},
+    {"_utsOperators_Rcpp_wrapper_ema_next_reverse_parallel", (DL_FUNC) &_utsOperators_Rcpp_wrapper_ema_next_reverse_parallel, 4},
+    {"_utsOperators_Rcpp_wrapper_kernel_stats_enabled", (DL_FUNC) &_utsOperators_Rcpp_wrapper_kernel_stats_enabled, 0},
+    {"_utsOperators_Rcpp_wrapper_kernel_stats_reset", (DL_FUNC) &_utsOperators_Rcpp_wrapper_kernel_stats_reset, 0},
+    {"_utsOperators_Rcpp_wrapper_kernel_stats", (DL_FUNC) &_utsOperators_Rcpp_wrapper_kernel_stats, 0},
     {"_utsOperators_Rcpp_wrapper_rolling_central_moment", (DL_FUNC) &_utsOperators_Rcpp_wrapper_rolling_central_moment, 5},
+    {"_utsOperators_Rcpp_wrapper_rolling_kurtosis", (DL_FUNC) &_utsOperators_Rcpp_wrapper_rolling_kurtosis, 4},
+    {"_utsOperators_Rcpp_wrapper_rolling_log_product", (DL_FUNC) &_utsOperators_Rcpp_wrapper_rolling_log_product, 4},
     {"_utsOperators_Rcpp_wrapper_rolling_max", (DL_FUNC) &_utsOperators_Rcpp_wrapper_rolling_max, 4},
     {"_utsOperators_Rcpp_wrapper_rolling_mean", (DL_FUNC) &_utsOperators_Rcpp_wrapper_rolling_mean, 4},
     {"_utsOperators_Rcpp_wrapper_rolling_median", (DL_FUNC) &_utsOperators_Rcpp_wrapper_rolling_median, 4},
     {"_utsOperators_Rcpp_wrapper_rolling_min", (DL_FUNC) &_utsOperators_Rcpp_wrapper_rolling_min, 4},
     {"_utsOperators_Rcpp_wrapper_rolling_num_obs", (DL_FUNC) &_utsOperators_Rcpp_wrapper_rolling_num_obs, 4},
     {"_utsOperators_Rcpp_wrapper_rolling_product", (DL_FUNC) &_utsOperators_Rcpp_wrapper_rolling_product, 4},
+    {"_utsOperators_Rcpp_wrapper_rolling_quantile", (DL_FUNC) &_utsOperators_Rcpp_wrapper_rolling_quantile, 5},
     {"_utsOperators_Rcpp_wrapper_rolling_sd", (DL_FUNC) &_utsOperators_Rcpp_wrapper_rolling_sd, 4},
+    {"_utsOperators_Rcpp_wrapper_rolling_skewness", (DL_FUNC) &_utsOperators_Rcpp_wrapper_rolling_skewness, 4},
     {"_utsOperators_Rcpp_wrapper_rolling_sum", (DL_FUNC) &_utsOperators_Rcpp_wrapper_rolling_sum, 4},
+    {"_utsOperators_Rcpp_wrapper_rolling_sum_exact", (DL_FUNC) &_utsOperators_Rcpp_wrapper_rolling_sum_exact, 4},
+    {"_utsOperators_Rcpp_wrapper_rolling_sum_neumaier", (DL_FUNC) &_utsOperators_Rcpp_wrapper_rolling_sum_neumaier, 4},
     {"_utsOperators_Rcpp_wrapper_rolling_sum_stable", (DL_FUNC) &_utsOperators_Rcpp_wrapper_rolling_sum_stable, 4},
     {"_utsOperators_Rcpp_wrapper_rolling_var", (DL_FUNC) &_utsOperators_Rcpp_wrapper_rolling_var, 4},
+    {"_utsOperators_Rcpp_wrapper_rolling_max_batch", (DL_FUNC) &_utsOperators_Rcpp_wrapper_rolling_max_batch, 4},
+    {"_utsOperators_Rcpp_wrapper_rolling_mean_batch", (DL_FUNC) &_utsOperators_Rcpp_wrapper_rolling_mean_batch, 4},
+    {"_utsOperators_Rcpp_wrapper_rolling_min_batch", (DL_FUNC) &_utsOperators_Rcpp_wrapper_rolling_min_batch, 4},
+    {"_utsOperators_Rcpp_wrapper_rolling_sd_batch", (DL_FUNC) &_utsOperators_Rcpp_wrapper_rolling_sd_batch, 4},
+    {"_utsOperators_Rcpp_wrapper_rolling_sum_batch", (DL_FUNC) &_utsOperators_Rcpp_wrapper_rolling_sum_batch, 4},
+    {"_utsOperators_Rcpp_wrapper_rolling_var_batch", (DL_FUNC) &_utsOperators_Rcpp_wrapper_rolling_var_batch, 4},
+    {"_utsOperators_Rcpp_wrapper_rolling_max_parallel", (DL_FUNC) &_utsOperators_Rcpp_wrapper_rolling_max_parallel, 6},
+    {"_utsOperators_Rcpp_wrapper_rolling_mean_parallel", (DL_FUNC) &_utsOperators_Rcpp_wrapper_rolling_mean_parallel, 6},
+    {"_utsOperators_Rcpp_wrapper_rolling_min_parallel", (DL_FUNC) &_utsOperators_Rcpp_wrapper_rolling_min_parallel, 6},
+    {"_utsOperators_Rcpp_wrapper_rolling_num_obs_parallel", (DL_FUNC) &_utsOperators_Rcpp_wrapper_rolling_num_obs_parallel, 6},
+    {"_utsOperators_Rcpp_wrapper_rolling_sum_parallel", (DL_FUNC) &_utsOperators_Rcpp_wrapper_rolling_sum_parallel, 6},
+    {"_utsOperators_Rcpp_wrapper_rolling_static_max", (DL_FUNC) &_utsOperators_Rcpp_wrapper_rolling_static_max, 4},
+    {"_utsOperators_Rcpp_wrapper_rolling_static_mean", (DL_FUNC) &_utsOperators_Rcpp_wrapper_rolling_static_mean, 4},
+    {"_utsOperators_Rcpp_wrapper_rolling_static_median", (DL_FUNC) &_utsOperators_Rcpp_wrapper_rolling_static_median, 4},
+    {"_utsOperators_Rcpp_wrapper_rolling_static_min", (DL_FUNC) &_utsOperators_Rcpp_wrapper_rolling_static_min, 4},
+    {"_utsOperators_Rcpp_wrapper_rolling_static_num_obs", (DL_FUNC) &_utsOperators_Rcpp_wrapper_rolling_static_num_obs, 4},
+    {"_utsOperators_Rcpp_wrapper_rolling_static_product", (DL_FUNC) &_utsOperators_Rcpp_wrapper_rolling_static_product, 4},
+    {"_utsOperators_Rcpp_wrapper_rolling_static_sum", (DL_FUNC) &_utsOperators_Rcpp_wrapper_rolling_static_sum, 4},
+    {"_utsOperators_Rcpp_wrapper_rolling_static_var", (DL_FUNC) &_utsOperators_Rcpp_wrapper_rolling_static_var, 4},
+    {"_utsOperators_Rcpp_wrapper_rolling_summary", (DL_FUNC) &_utsOperators_Rcpp_wrapper_rolling_summary, 5},
     {"_utsOperators_Rcpp_wrapper_sma_last", (DL_FUNC) &_utsOperators_Rcpp_wrapper_sma_last, 4},
     {"_utsOperators_Rcpp_wrapper_sma_linear", (DL_FUNC) &_utsOperators_Rcpp_wrapper_sma_linear, 4},
     {"_utsOperators_Rcpp_wrapper_sma_next", (DL_FUNC) &_utsOperators_Rcpp_wrapper_sma_next, 4},
+    {"_utsOperators_Rcpp_wrapper_sma_last_batch", (DL_FUNC) &_utsOperators_Rcpp_wrapper_sma_last_batch, 4},
+    {"_utsOperators_Rcpp_wrapper_sma_linear_batch", (DL_FUNC) &_utsOperators_Rcpp_wrapper_sma_linear_batch, 4},
+    {"_utsOperators_Rcpp_wrapper_sma_next_batch", (DL_FUNC) &_utsOperators_Rcpp_wrapper_sma_next_batch, 4},
+    {"_utsOperators_Rcpp_wrapper_sma_last_parallel", (DL_FUNC) &_utsOperators_Rcpp_wrapper_sma_last_parallel, 6},
+    {"_utsOperators_Rcpp_wrapper_sma_linear_parallel", (DL_FUNC) &_utsOperators_Rcpp_wrapper_sma_linear_parallel, 6},
+    {"_utsOperators_Rcpp_wrapper_sma_next_parallel", (DL_FUNC) &_utsOperators_Rcpp_wrapper_sma_next_parallel, 6},
+    {"_utsOperators_Rcpp_wrapper_sma_last_query", (DL_FUNC) &_utsOperators_Rcpp_wrapper_sma_last_query, 5},
+    {"_utsOperators_Rcpp_wrapper_sma_linear_query", (DL_FUNC) &_utsOperators_Rcpp_wrapper_sma_linear_query, 5},
+    {"_utsOperators_Rcpp_wrapper_sma_next_query", (DL_FUNC) &_utsOperators_Rcpp_wrapper_sma_next_query, 5},
+    {"_utsOperators_Rcpp_wrapper_streaming_ema_new", (DL_FUNC) &_utsOperators_Rcpp_wrapper_streaming_ema_new, 2},
+    {"_utsOperators_Rcpp_wrapper_streaming_sma_new", (DL_FUNC) &_utsOperators_Rcpp_wrapper_streaming_sma_new, 2},
+    {"_utsOperators_Rcpp_wrapper_streaming_rolling_new", (DL_FUNC) &_utsOperators_Rcpp_wrapper_streaming_rolling_new, 2},
+    {"_utsOperators_Rcpp_wrapper_streaming_push", (DL_FUNC) &_utsOperators_Rcpp_wrapper_streaming_push, 3},
+    {"_utsOperators_Rcpp_wrapper_streaming_description", (DL_FUNC) &_utsOperators_Rcpp_wrapper_streaming_description, 1},
+    {"_utsOperators_Rcpp_wrapper_streaming_save", (DL_FUNC) &_utsOperators_Rcpp_wrapper_streaming_save, 1},
+    {"_utsOperators_Rcpp_wrapper_streaming_restore", (DL_FUNC) &_utsOperators_Rcpp_wrapper_streaming_restore, 1},
+    {"_utsOperators_Rcpp_wrapper_uts_file_write", (DL_FUNC) &_utsOperators_Rcpp_wrapper_uts_file_write, 5},
+    {"_utsOperators_Rcpp_wrapper_uts_file_info", (DL_FUNC) &_utsOperators_Rcpp_wrapper_uts_file_info, 1},
+    {"_utsOperators_Rcpp_wrapper_uts_file_read", (DL_FUNC) &_utsOperators_Rcpp_wrapper_uts_file_read, 3},
+    {"_utsOperators_Rcpp_wrapper_uts_file_apply", (DL_FUNC) &_utsOperators_Rcpp_wrapper_uts_file_apply, 5},
+    {"_utsOperators_Rcpp_wrapper_uts_file_apply_ema", (DL_FUNC) &_utsOperators_Rcpp_wrapper_uts_file_apply_ema, 4},
     {NULL, NULL, 0}
 };
 
@@ -1,18 +1,48 @@
 // Copyright: 2012-2018 by Andreas Eckner
 // License: GPL-2 | GPL-3
 
+#include <float.h>
 #include <math.h>
+#include <stdlib.h>
+#include "instrument.h"
 #include "ema.h"
 
+#ifndef MIN
+#  define MIN(a,b) (((a) < (b)) ? (a) : (b))
+#endif
 
-// EMA_next(X, tau)
-void ema_next(const double values[], const double times[], const int *n, double values_new[], const double *tau)
+
+// Kernels for double and float observation values, compiled from the same source code in ema_template.h
+#define VALUE_TYPE double
+#define KERNEL_NAME(name) name##_long
+#include "ema_template.h"
+#undef VALUE_TYPE
+#undef KERNEL_NAME
+
+#define VALUE_TYPE float
+#define KERNEL_NAME(name) name##_float_long
+#include "ema_template.h"
+#undef VALUE_TYPE
+#undef KERNEL_NAME
+
+
+/************ Batch versions for several time series with identical observation times ************/
+// -) the observation values of the time series are stored in row-major order, i.e. values[k + j * *num_cols] is the
+//    j-th observation value of the k-th time series, and the output is stored in the same way
+// -) the EMA weights are calculated only once per observation time, and the inner loop runs over all time series, i.e.
+//    over contiguous memory, so that it can be vectorized
+
+
+// EMA_next(X, tau) for several time series
+void ema_next_batch_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *tau, const int *num_cols)
 {
-  // values     ... array of time series values
+  // values     ... array of length *n * *num_cols of time series values
   // times      ... array of observation times
-  // n          ... number of observations, i.e. length of 'values' and 'times'
-  // values_new ... array of length *n to store output time series values
+  // n          ... number of observations, i.e. length of 'times'
+  // values_new ... array of length *n * *num_cols to store output time series values
   // tau        ... (positive) half-life of EMA kernel
+  // num_cols   ... number of time series
   
   double w;
   
@@ -21,22 +51,28 @@ void ema_next(const double values[], const double times[], const int *n, double
     return;
   
   // Calculate ema recursively
-  values_new[0] = values[0];
-  for (int i = 1; i < *n; i++) {
+  for (int k = 0; k < *num_cols; k++)
+    values_new[k] = values[k];
+  for (ptrdiff_t i = 1; i < *n; i++) {
+    const double *row = values + (size_t) i * *num_cols;      // observation values at time i
+    double *row_new = values_new + (size_t) i * *num_cols;    // output values at time i
     w = exp(-(times[i] - times[i-1]) / *tau);
-    values_new[i] = values_new[i-1] * w + values[i] * (1-w);
+    for (int k = 0; k < *num_cols; k++)
+      row_new[k] = row_new[k - *num_cols] * w + row[k] * (1-w);
   }
 }
 
 
-// EMA_last(X, tau)
-void ema_last(const double values[], const double times[], const int *n, double values_new[], const double *tau)
+// EMA_last(X, tau) for several time series
+void ema_last_batch_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *tau, const int *num_cols)
 {
-  // values     ... array of time series values
+  // values     ... array of length *n * *num_cols of time series values
   // times      ... array of observation times
-  // n          ... number of observations, i.e. length of 'values' and 'times'
-  // values_new ... array of length *n to store output time series values
+  // n          ... number of observations, i.e. length of 'times'
+  // values_new ... array of length *n * *num_cols to store output time series values
   // tau        ... (positive) half-life of EMA kernel
+  // num_cols   ... number of time series
   
   double w;
   
@@ -44,35 +80,281 @@ void ema_last(const double values[], const double times[], const int *n, double
   if (*n == 0)
     return;
   
-  // Calculate ema recursively   
-  values_new[0] = values[0];
-  for (int i = 1; i < *n; i++) {
+  // Calculate ema recursively
+  for (int k = 0; k < *num_cols; k++)
+    values_new[k] = values[k];
+  for (ptrdiff_t i = 1; i < *n; i++) {
+    const double *row = values + (size_t) i * *num_cols;      // observation values at time i
+    double *row_new = values_new + (size_t) i * *num_cols;    // output values at time i
     w = exp(-(times[i] - times[i-1]) / *tau);
-    values_new[i] = values_new[i-1] * w + values[i-1] * (1-w);
+    for (int k = 0; k < *num_cols; k++)
+      row_new[k] = row_new[k - *num_cols] * w + row[k - *num_cols] * (1-w);
   }
+}
+
+
+// EMA_lin(X, tau) for several time series
+void ema_linear_batch_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *tau, const int *num_cols)
+{
+  // values     ... array of length *n * *num_cols of time series values
+  // times      ... array of observation times
+  // n          ... number of observations, i.e. length of 'times'
+  // values_new ... array of length *n * *num_cols to store output time series values
+  // tau        ... (positive) half-life of EMA kernel
+  // num_cols   ... number of time series
   
+  double w, w2, tmp;
+  
+  // Trivial case
+  if (*n == 0)
+    return;
+  
+  // Calculate ema recursively
+  for (int k = 0; k < *num_cols; k++)
+    values_new[k] = values[k];
+  for (ptrdiff_t i = 1; i < *n; i++) {
+    const double *row = values + (size_t) i * *num_cols;      // observation values at time i
+    double *row_new = values_new + (size_t) i * *num_cols;    // output values at time i
+    tmp = (times[i] - times[i-1]) / *tau;
+    w = exp(-tmp);
+    if (tmp > 1e-6)
+      w2 = (1 - w) / tmp;
+    else {
+      // Use Taylor expansion for numerical stability
+      w2 = 1 - tmp/2 + tmp*tmp/6 - tmp*tmp*tmp/24;
+    }
+    for (int k = 0; k < *num_cols; k++)
+      row_new[k] = row_new[k - *num_cols] * w + row[k] * (1 - w2) + row[k - *num_cols] * (w2 - w);
+  }
 }
 
 
-// EMA_lin(X, tau)
-void ema_linear(const double values[], const double times[], const int *n, double values_new[], const double *tau)
+
+/************ EMA banks for several half-lives ************/
+// -) the output for the k-th half-life is stored in values_new[k * *n], ..., values_new[(k+1) * *n - 1]
+// -) for each observation time, the time difference and observation values are loaded once, and the inner loops run
+//    over contiguous arrays of half-lives, EMA weights and current EMA values
+
+
+// EMA_next(X, tau) for several half-lives tau
+void ema_next_bank_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double tau[], const int *num_taus)
+{
+  // values     ... array of time series values
+  // times      ... array of observation times
+  // n          ... number of observations, i.e. length of 'values' and 'times'
+  // values_new ... array of length *n * *num_taus to store output time series values
+  // tau        ... array of (positive) half-lives of EMA kernel
+  // num_taus   ... number of half-lives, i.e. length of 'tau'
+  
+  double dt, value;
+  int k;
+  
+  // Trivial case
+  if (*n == 0)
+    return;
+  
+  // Initialize output
+  double *ema = INSTRUMENT_MALLOC(*num_taus * sizeof(double));
+  double *w = INSTRUMENT_MALLOC(*num_taus * sizeof(double));
+  for (k = 0; k < *num_taus; k++) {
+    ema[k] = values[0];
+    values_new[(size_t) k * *n] = values[0];
+  }
+  
+  // Calculate emas recursively
+  for (ptrdiff_t i = 1; i < *n; i++) {
+    dt = times[i] - times[i-1];
+    value = values[i];
+    for (k = 0; k < *num_taus; k++)
+      w[k] = exp(-dt / tau[k]);
+    for (k = 0; k < *num_taus; k++) {
+      ema[k] = ema[k] * w[k] + value * (1-w[k]);
+      values_new[i + (size_t) k * *n] = ema[k];
+    }
+  }
+  free(ema);
+  free(w);
+}
+
+
+// EMA_last(X, tau) for several half-lives tau
+void ema_last_bank_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double tau[], const int *num_taus)
+{
+  // values     ... array of time series values
+  // times      ... array of observation times
+  // n          ... number of observations, i.e. length of 'values' and 'times'
+  // values_new ... array of length *n * *num_taus to store output time series values
+  // tau        ... array of (positive) half-lives of EMA kernel
+  // num_taus   ... number of half-lives, i.e. length of 'tau'
+  
+  double dt, value;
+  int k;
+  
+  // Trivial case
+  if (*n == 0)
+    return;
+  
+  // Initialize output
+  double *ema = INSTRUMENT_MALLOC(*num_taus * sizeof(double));
+  double *w = INSTRUMENT_MALLOC(*num_taus * sizeof(double));
+  for (k = 0; k < *num_taus; k++) {
+    ema[k] = values[0];
+    values_new[(size_t) k * *n] = values[0];
+  }
+  
+  // Calculate emas recursively
+  for (ptrdiff_t i = 1; i < *n; i++) {
+    dt = times[i] - times[i-1];
+    value = values[i-1];
+    for (k = 0; k < *num_taus; k++)
+      w[k] = exp(-dt / tau[k]);
+    for (k = 0; k < *num_taus; k++) {
+      ema[k] = ema[k] * w[k] + value * (1-w[k]);
+      values_new[i + (size_t) k * *n] = ema[k];
+    }
+  }
+  free(ema);
+  free(w);
+}
+
+
+// EMA_lin(X, tau) for several half-lives tau
+void ema_linear_bank_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double tau[], const int *num_taus)
+{
+  // values     ... array of time series values
+  // times      ... array of observation times
+  // n          ... number of observations, i.e. length of 'values' and 'times'
+  // values_new ... array of length *n * *num_taus to store output time series values
+  // tau        ... array of (positive) half-lives of EMA kernel
+  // num_taus   ... number of half-lives, i.e. length of 'tau'
+  
+  double dt, tmp, value, value_prev;
+  int k;
+  
+  // Trivial case
+  if (*n == 0)
+    return;
+  
+  // Initialize output
+  double *ema = INSTRUMENT_MALLOC(*num_taus * sizeof(double));
+  double *w = INSTRUMENT_MALLOC(*num_taus * sizeof(double));
+  double *w2 = INSTRUMENT_MALLOC(*num_taus * sizeof(double));
+  for (k = 0; k < *num_taus; k++) {
+    ema[k] = values[0];
+    values_new[(size_t) k * *n] = values[0];
+  }
+  
+  // Calculate emas recursively
+  for (ptrdiff_t i = 1; i < *n; i++) {
+    dt = times[i] - times[i-1];
+    value = values[i];
+    value_prev = values[i-1];
+    for (k = 0; k < *num_taus; k++) {
+      tmp = dt / tau[k];
+      w[k] = exp(-tmp);
+      if (tmp > 1e-6)
+        w2[k] = (1 - w[k]) / tmp;
+      else {
+        // Use Taylor expansion for numerical stability
+        w2[k] = 1 - tmp/2 + tmp*tmp/6 - tmp*tmp*tmp/24;
+      }
+    }
+    for (k = 0; k < *num_taus; k++) {
+      ema[k] = ema[k] * w[k] + value * (1 - w2[k]) + value_prev * (w2[k] - w[k]);
+      values_new[i + (size_t) k * *n] = ema[k];
+    }
+  }
+  free(ema);
+  free(w);
+  free(w2);
+}
+
+
+
+/************ Forward-looking EMAs ************/
+// -) a forward-looking EMA with half-life -tau < 0 is calculated by a reverse scan from the last to the first
+//    observation, i.e. the recursion runs backward in time with the same weights as the backward-looking EMA with
+//    half-life tau. This avoids reversing the time series before and after calling the backward-looking kernel.
+// -) for last-point interpolation, the sample path on [t_i, t_{i+1}) equals the earlier observation value values[i],
+//    and for next-point interpolation it equals the later observation value values[i+1], as for backward-looking EMAs
+
+
+// Forward-looking EMA_next(X, -tau)
+void ema_next_reverse_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *tau)
 {
   // values     ... array of time series values
   // times      ... array of observation times
   // n          ... number of observations, i.e. length of 'values' and 'times'
   // values_new ... array of length *n to store output time series values
-  // tau        ... (positive) half-life of EMA kernel
+  // tau        ... (positive) absolute value of the half-life of EMA kernel
   
-  double w, w2, tmp;
+  double w, ema;
   
   // Trivial case
   if (*n == 0)
     return;
   
-  // Calculate ema recursively   
-  values_new[0] = values[0];   
-  for (int i = 1; i < *n; i++) {
-    tmp = (times[i] - times[i-1]) / *tau;
+  // Calculate ema recursively, starting with the last observation
+  values_new[*n-1] = ema = values[*n-1];
+  for (ptrdiff_t i = *n - 2; i >= 0; i--) {
+    w = exp(-(times[i+1] - times[i]) / *tau);
+    ema = ema * w + values[i+1] * (1-w);
+    values_new[i] = ema;
+  }
+}
+
+
+// Forward-looking EMA_last(X, -tau)
+void ema_last_reverse_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *tau)
+{
+  // values     ... array of time series values
+  // times      ... array of observation times
+  // n          ... number of observations, i.e. length of 'values' and 'times'
+  // values_new ... array of length *n to store output time series values
+  // tau        ... (positive) absolute value of the half-life of EMA kernel
+  
+  double w, ema;
+  
+  // Trivial case
+  if (*n == 0)
+    return;
+  
+  // Calculate ema recursively, starting with the last observation
+  values_new[*n-1] = ema = values[*n-1];
+  for (ptrdiff_t i = *n - 2; i >= 0; i--) {
+    w = exp(-(times[i+1] - times[i]) / *tau);
+    ema = ema * w + values[i] * (1-w);
+    values_new[i] = ema;
+  }
+}
+
+
+// Forward-looking EMA_lin(X, -tau)
+void ema_linear_reverse_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *tau)
+{
+  // values     ... array of time series values
+  // times      ... array of observation times
+  // n          ... number of observations, i.e. length of 'values' and 'times'
+  // values_new ... array of length *n to store output time series values
+  // tau        ... (positive) absolute value of the half-life of EMA kernel
+  
+  double w, w2, tmp, ema;
+  
+  // Trivial case
+  if (*n == 0)
+    return;
+  
+  // Calculate ema recursively, starting with the last observation
+  values_new[*n-1] = ema = values[*n-1];
+  for (ptrdiff_t i = *n - 2; i >= 0; i--) {
+    tmp = (times[i+1] - times[i]) / *tau;
     w = exp(-tmp);
     if (tmp > 1e-6)
       w2 = (1 - w) / tmp;
@@ -80,6 +362,907 @@ void ema_linear(const double values[], const double times[], const int *n, doubl
       // Use Taylor expansion for numerical stability
       w2 = 1 - tmp/2 + tmp*tmp/6 - tmp*tmp*tmp/24;
     }
-    values_new[i] = values_new[i-1] * w + values[i] * (1 - w2) + values[i-1] * (w2 - w);
+    ema = ema * w + values[i] * (1 - w2) + values[i+1] * (w2 - w);
+    values_new[i] = ema;
+  }
+}
+
+
+// Forward-looking EMA_next(X, -tau) for several half-lives -tau
+void ema_next_reverse_bank_long(const double values[], const double times[], const ptrdiff_t *n,
+  double values_new[], const double tau[], const int *num_taus)
+{
+  // values     ... array of time series values
+  // times      ... array of observation times
+  // n          ... number of observations, i.e. length of 'values' and 'times'
+  // values_new ... array of length *n * *num_taus to store output time series values
+  // tau        ... array of (positive) absolute values of the half-lives of EMA kernel
+  // num_taus   ... number of half-lives, i.e. length of 'tau'
+  
+  double dt, value;
+  int k;
+  
+  // Trivial case
+  if (*n == 0)
+    return;
+  
+  // Initialize output
+  double *ema = INSTRUMENT_MALLOC(*num_taus * sizeof(double));
+  double *w = INSTRUMENT_MALLOC(*num_taus * sizeof(double));
+  for (k = 0; k < *num_taus; k++) {
+    ema[k] = values[*n-1];
+    values_new[*n-1 + (size_t) k * *n] = values[*n-1];
+  }
+  
+  // Calculate emas recursively, starting with the last observation
+  for (ptrdiff_t i = *n - 2; i >= 0; i--) {
+    dt = times[i+1] - times[i];
+    value = values[i+1];
+    for (k = 0; k < *num_taus; k++)
+      w[k] = exp(-dt / tau[k]);
+    for (k = 0; k < *num_taus; k++) {
+      ema[k] = ema[k] * w[k] + value * (1-w[k]);
+      values_new[i + (size_t) k * *n] = ema[k];
+    }
+  }
+  free(ema);
+  free(w);
+}
+
+
+// Forward-looking EMA_last(X, -tau) for several half-lives -tau
+void ema_last_reverse_bank_long(const double values[], const double times[], const ptrdiff_t *n,
+  double values_new[], const double tau[], const int *num_taus)
+{
+  // values     ... array of time series values
+  // times      ... array of observation times
+  // n          ... number of observations, i.e. length of 'values' and 'times'
+  // values_new ... array of length *n * *num_taus to store output time series values
+  // tau        ... array of (positive) absolute values of the half-lives of EMA kernel
+  // num_taus   ... number of half-lives, i.e. length of 'tau'
+  
+  double dt, value;
+  int k;
+  
+  // Trivial case
+  if (*n == 0)
+    return;
+  
+  // Initialize output
+  double *ema = INSTRUMENT_MALLOC(*num_taus * sizeof(double));
+  double *w = INSTRUMENT_MALLOC(*num_taus * sizeof(double));
+  for (k = 0; k < *num_taus; k++) {
+    ema[k] = values[*n-1];
+    values_new[*n-1 + (size_t) k * *n] = values[*n-1];
+  }
+  
+  // Calculate emas recursively, starting with the last observation
+  for (ptrdiff_t i = *n - 2; i >= 0; i--) {
+    dt = times[i+1] - times[i];
+    value = values[i];
+    for (k = 0; k < *num_taus; k++)
+      w[k] = exp(-dt / tau[k]);
+    for (k = 0; k < *num_taus; k++) {
+      ema[k] = ema[k] * w[k] + value * (1-w[k]);
+      values_new[i + (size_t) k * *n] = ema[k];
+    }
+  }
+  free(ema);
+  free(w);
+}
+
+
+// Forward-looking EMA_lin(X, -tau) for several half-lives -tau
+void ema_linear_reverse_bank_long(const double values[], const double times[], const ptrdiff_t *n,
+  double values_new[], const double tau[], const int *num_taus)
+{
+  // values     ... array of time series values
+  // times      ... array of observation times
+  // n          ... number of observations, i.e. length of 'values' and 'times'
+  // values_new ... array of length *n * *num_taus to store output time series values
+  // tau        ... array of (positive) absolute values of the half-lives of EMA kernel
+  // num_taus   ... number of half-lives, i.e. length of 'tau'
+  
+  double dt, tmp, value, value_next;
+  int k;
+  
+  // Trivial case
+  if (*n == 0)
+    return;
+  
+  // Initialize output
+  double *ema = INSTRUMENT_MALLOC(*num_taus * sizeof(double));
+  double *w = INSTRUMENT_MALLOC(*num_taus * sizeof(double));
+  double *w2 = INSTRUMENT_MALLOC(*num_taus * sizeof(double));
+  for (k = 0; k < *num_taus; k++) {
+    ema[k] = values[*n-1];
+    values_new[*n-1 + (size_t) k * *n] = values[*n-1];
+  }
+  
+  // Calculate emas recursively, starting with the last observation
+  for (ptrdiff_t i = *n - 2; i >= 0; i--) {
+    dt = times[i+1] - times[i];
+    value = values[i];
+    value_next = values[i+1];
+    for (k = 0; k < *num_taus; k++) {
+      tmp = dt / tau[k];
+      w[k] = exp(-tmp);
+      if (tmp > 1e-6)
+        w2[k] = (1 - w[k]) / tmp;
+      else {
+        // Use Taylor expansion for numerical stability
+        w2[k] = 1 - tmp/2 + tmp*tmp/6 - tmp*tmp*tmp/24;
+      }
+    }
+    for (k = 0; k < *num_taus; k++) {
+      ema[k] = ema[k] * w[k] + value * (1 - w2[k]) + value_next * (w2[k] - w[k]);
+      values_new[i + (size_t) k * *n] = ema[k];
+    }
+  }
+  free(ema);
+  free(w);
+  free(w2);
+}
+
+
+
+/************ Multi-threaded EMAs ************/
+// -) each EMA step y_i = w_i * y_{i-1} + b_i is an affine map, and the composition of affine maps is associative
+// -) the observations are split into one chunk per thread. In a first parallel pass, the composed affine map
+//    (multiplier, offset) of each chunk is calculated. A short serial pass over the chunk summaries then determines
+//    the EMA value at the start of each chunk, and a second parallel pass calculates the output values.
+// -) within the chunk where the recursion starts, the output is identical to the serial kernel. In later chunks, the
+//    starting value differs from the serial kernel by rounding errors of the composed affine maps, i.e. by a few
+//    multiples of the machine epsilon relative to the magnitude of the observation values, and this difference decays
+//    exponentially.
+// -) forward-looking EMAs use the same parallel scan in the opposite direction, i.e. the EMA value at the end of each
+//    chunk is determined by a serial pass over the chunk summaries from the last to the first chunk
+// -) the first parallel pass stores the EMA weights exp(-dt/tau) in the output array, where the second parallel pass
+//    reads them before overwriting them with the output values, so that exp() is called only once per observation
+
+// Minimum number of observations per thread, to avoid the threading overhead for short time series
+#ifndef EMA_PARALLEL_MIN_CHUNK
+#  define EMA_PARALLEL_MIN_CHUNK 100000
+#endif
+
+
+// Calculate the weight w_i and offset b_i of the EMA step y_i = w_i * y_{i-1} + b_i for observation i >= 1, or of the
+// step y_i = w_i * y_{i+1} + b_i for observation i <= n - 2 of a reverse scan
+static inline void ema_affine_step(const double values[], const double times[], ptrdiff_t i, double tau,
+  enum ema_interpolation interpolation, int reverse, double *w, double *b)
+{
+  // values        ... array of time series values
+  // times         ... array of observation times
+  // i             ... index of observation
+  // tau           ... (positive) half-life of EMA kernel
+  // interpolation ... sample path interpolation method
+  // reverse       ... 1 for a reverse scan (i.e. a forward-looking EMA), and 0 otherwise
+  // w             ... weight of previous EMA value
+  // b             ... offset
+  
+  double tmp, w2;
+  ptrdiff_t prev = reverse ? i+1 : i-1;              // previous observation of the recursion
+  ptrdiff_t lo = reverse ? i : i-1, hi = lo + 1;     // observations at the start and end of the time interval
+  
+  if (interpolation == EMA_LINEAR) {
+    tmp = (times[hi] - times[lo]) / tau;
+    *w = exp(-tmp);
+    if (tmp > 1e-6)
+      w2 = (1 - *w) / tmp;
+    else {
+      // Use Taylor expansion for numerical stability
+      w2 = 1 - tmp/2 + tmp*tmp/6 - tmp*tmp*tmp/24;
+    }
+    *b = values[i] * (1 - w2) + values[prev] * (w2 - *w);
+  } else {
+    *w = exp(-(times[hi] - times[lo]) / tau);
+    *b = values[interpolation == EMA_NEXT ? hi : lo] * (1 - *w);
+  }
+}
+
+
+// Calculate the EMA for observations start, ..., end - 1, given the EMA value for observation start - 1, or for a
+// reverse scan, given the EMA value for observation end
+// -) uses the same order of floating-point operations as the serial kernels
+static inline void ema_range(const double values[], const double times[], ptrdiff_t start, ptrdiff_t end,
+  double values_new[], double tau, enum ema_interpolation interpolation, int reverse, int cached_weights,
+  double ema_prev)
+{
+  // values         ... array of time series values
+  // times          ... array of observation times
+  // start          ... index of first observation (needs to be positive, unless reverse = 1)
+  // end            ... index one past the last observation (needs to be less than n, if reverse = 1)
+  // values_new     ... array to store output time series values
+  // tau            ... (positive) half-life of EMA kernel
+  // interpolation  ... sample path interpolation method
+  // reverse        ... 1 for a reverse scan (i.e. a forward-looking EMA), and 0 otherwise
+  // cached_weights ... 1 if values_new[start], ..., values_new[end - 1] contain the EMA weights (see ema_parallel),
+  //                    and 0 otherwise
+  // ema_prev       ... EMA value for observation start - 1, or for observation end if reverse = 1
+  
+  double w, w2, tmp;
+  ptrdiff_t i, prev, lo, hi;
+  
+  for (ptrdiff_t k = start; k < end; k++) {
+    i = reverse ? start + end - 1 - k : k;
+    prev = reverse ? i+1 : i-1;
+    lo = reverse ? i : i-1;
+    hi = lo + 1;
+    if (interpolation == EMA_LINEAR) {
+      tmp = (times[hi] - times[lo]) / tau;
+      w = cached_weights ? values_new[i] : exp(-tmp);
+      if (tmp > 1e-6)
+        w2 = (1 - w) / tmp;
+      else {
+        // Use Taylor expansion for numerical stability
+        w2 = 1 - tmp/2 + tmp*tmp/6 - tmp*tmp*tmp/24;
+      }
+      ema_prev = ema_prev * w + values[i] * (1 - w2) + values[prev] * (w2 - w);
+    } else {
+      w = cached_weights ? values_new[i] : exp(-(times[hi] - times[lo]) / tau);
+      ema_prev = ema_prev * w + values[interpolation == EMA_NEXT ? hi : lo] * (1-w);
+    }
+    values_new[i] = ema_prev;
+  }
+}
+
+
+// Multi-threaded EMA using a parallel scan over affine EMA steps
+static void ema_parallel(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *tau, enum ema_interpolation interpolation, int reverse, const int *num_threads)
+{
+  // values        ... array of time series values
+  // times         ... array of observation times
+  // n             ... number of observations, i.e. length of 'values' and 'times'
+  // values_new    ... array of length *n to store output time series values
+  // tau           ... (positive) half-life of EMA kernel
+  // interpolation ... sample path interpolation method
+  // reverse       ... 1 for a reverse scan (i.e. a forward-looking EMA), and 0 otherwise
+  // num_threads   ... maximum number of threads to use
+  
+  // Trivial case
+  if (*n == 0)
+    return;
+  
+  // Determine number of chunks
+  int num_chunks = *num_threads;
+  if (num_chunks > (*n - 1) / EMA_PARALLEL_MIN_CHUNK)
+    num_chunks = (*n - 1) / EMA_PARALLEL_MIN_CHUNK;
+#ifndef _OPENMP
+  num_chunks = 1;
+#endif
+  
+  // Serial case, where the recursion starts at the first (or for a reverse scan, the last) observation, and
+  // calculates the EMA for the remaining observations first, ..., first + *n - 2
+  ptrdiff_t initial = reverse ? *n - 1 : 0, first = reverse ? 0 : 1;
+  values_new[initial] = values[initial];
+  if (num_chunks <= 1) {
+    ema_range(values, times, first, first + *n - 1, values_new, *tau, interpolation, reverse, 0, values[initial]);
+    return;
+  }
+  
+  // Composed affine map (multiplier, offset) of each chunk of observations first, ..., first + *n - 2
+  double *multiplier = INSTRUMENT_MALLOC(num_chunks * sizeof(double));
+  double *offset = INSTRUMENT_MALLOC(num_chunks * sizeof(double));
+  double *ema_start = INSTRUMENT_MALLOC(num_chunks * sizeof(double));
+  
+  #pragma omp parallel for num_threads(num_chunks) schedule(static, 1)
+  for (int c = 0; c < num_chunks; c++) {
+    ptrdiff_t start = first + (*n - 1) * c / num_chunks;
+    ptrdiff_t end = first + (*n - 1) * (c + 1) / num_chunks;
+    double a = 1, b = 0, w_i, b_i;
+    for (ptrdiff_t k = start; k < end; k++) {
+      ptrdiff_t i = reverse ? start + end - 1 - k : k;
+      ema_affine_step(values, times, i, *tau, interpolation, reverse, &w_i, &b_i);
+      values_new[i] = w_i;
+      a = w_i * a;
+      b = w_i * b + b_i;
+      if (a < DBL_MIN)    // avoid slow arithmetic with subnormal numbers, contribution of a is negligible
+        a = 0;
+    }
+    multiplier[c] = a;
+    offset[c] = b;
   }
+  
+  // Determine the EMA value before the start of each chunk (in the direction of the recursion)
+  if (!reverse) {
+    ema_start[0] = values[0];
+    for (int c = 1; c < num_chunks; c++)
+      ema_start[c] = multiplier[c-1] * ema_start[c-1] + offset[c-1];
+  } else {
+    ema_start[num_chunks-1] = values[*n-1];
+    for (int c = num_chunks - 2; c >= 0; c--)
+      ema_start[c] = multiplier[c+1] * ema_start[c+1] + offset[c+1];
+  }
+  
+  // Calculate the output values
+  #pragma omp parallel for num_threads(num_chunks) schedule(static, 1)
+  for (int c = 0; c < num_chunks; c++) {
+    ptrdiff_t start = first + (*n - 1) * c / num_chunks;
+    ptrdiff_t end = first + (*n - 1) * (c + 1) / num_chunks;
+    ema_range(values, times, start, end, values_new, *tau, interpolation, reverse, 1, ema_start[c]);
+  }
+  
+  free(multiplier);
+  free(offset);
+  free(ema_start);
+}
+
+
+// EMA_next(X, tau) using several threads
+void ema_next_parallel_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *tau, const int *num_threads)
+{
+  // values      ... array of time series values
+  // times       ... array of observation times
+  // n           ... number of observations, i.e. length of 'values' and 'times'
+  // values_new  ... array of length *n to store output time series values
+  // tau         ... (positive) half-life of EMA kernel
+  // num_threads ... maximum number of threads to use
+  
+  ema_parallel(values, times, n, values_new, tau, EMA_NEXT, 0, num_threads);
+}
+
+
+// EMA_last(X, tau) using several threads
+void ema_last_parallel_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *tau, const int *num_threads)
+{
+  // values      ... array of time series values
+  // times       ... array of observation times
+  // n           ... number of observations, i.e. length of 'values' and 'times'
+  // values_new  ... array of length *n to store output time series values
+  // tau         ... (positive) half-life of EMA kernel
+  // num_threads ... maximum number of threads to use
+  
+  ema_parallel(values, times, n, values_new, tau, EMA_LAST, 0, num_threads);
+}
+
+
+// EMA_lin(X, tau) using several threads
+void ema_linear_parallel_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *tau, const int *num_threads)
+{
+  // values      ... array of time series values
+  // times       ... array of observation times
+  // n           ... number of observations, i.e. length of 'values' and 'times'
+  // values_new  ... array of length *n to store output time series values
+  // tau         ... (positive) half-life of EMA kernel
+  // num_threads ... maximum number of threads to use
+  
+  ema_parallel(values, times, n, values_new, tau, EMA_LINEAR, 0, num_threads);
+}
+
+
+// Forward-looking EMA_next(X, -tau) using several threads
+void ema_next_reverse_parallel_long(const double values[], const double times[], const ptrdiff_t *n,
+  double values_new[], const double *tau, const int *num_threads)
+{
+  // values      ... array of time series values
+  // times       ... array of observation times
+  // n           ... number of observations, i.e. length of 'values' and 'times'
+  // values_new  ... array of length *n to store output time series values
+  // tau         ... (positive) absolute value of the half-life of EMA kernel
+  // num_threads ... maximum number of threads to use
+  
+  ema_parallel(values, times, n, values_new, tau, EMA_NEXT, 1, num_threads);
+}
+
+
+// Forward-looking EMA_last(X, -tau) using several threads
+void ema_last_reverse_parallel_long(const double values[], const double times[], const ptrdiff_t *n,
+  double values_new[], const double *tau, const int *num_threads)
+{
+  // values      ... array of time series values
+  // times       ... array of observation times
+  // n           ... number of observations, i.e. length of 'values' and 'times'
+  // values_new  ... array of length *n to store output time series values
+  // tau         ... (positive) absolute value of the half-life of EMA kernel
+  // num_threads ... maximum number of threads to use
+  
+  ema_parallel(values, times, n, values_new, tau, EMA_LAST, 1, num_threads);
+}
+
+
+// Forward-looking EMA_lin(X, -tau) using several threads
+void ema_linear_reverse_parallel_long(const double values[], const double times[], const ptrdiff_t *n,
+  double values_new[], const double *tau, const int *num_threads)
+{
+  // values      ... array of time series values
+  // times       ... array of observation times
+  // n           ... number of observations, i.e. length of 'values' and 'times'
+  // values_new  ... array of length *n to store output time series values
+  // tau         ... (positive) absolute value of the half-life of EMA kernel
+  // num_threads ... maximum number of threads to use
+  
+  ema_parallel(values, times, n, values_new, tau, EMA_LINEAR, 1, num_threads);
+}
+
+
+
+/************ Iterated EMAs ************/
+// -) EMA(X, tau, j) = EMA(EMA(X, tau, j-1), tau) denotes the j-fold iterated EMA. The first stage uses the requested
+//    sample path interpolation, while all later stages use linear interpolation, because the sample path of an EMA is
+//    continuous. Each stage uses the same order of floating-point operations as the corresponding serial kernel, so
+//    that EMA(X, tau, j) is identical to j nested calls of the serial kernels.
+// -) only the current value of each stage is kept, i.e. no intermediate time series of length *n is allocated
+// -) the EMA weights are calculated only once per observation time, because all stages have the same half-life
+
+
+// Update the iterated EMAs ema[0], ..., ema[k-1] for observation i >= 1, given the current input value and the
+// previous input value
+static inline void ema_iterated_step(double ema[], int k, double value, double value_prev, double tmp,
+  enum ema_interpolation interpolation)
+{
+  // ema           ... array of length k of iterated EMA values, updated in place
+  // k             ... number of iterations
+  // value         ... input value at observation i
+  // value_prev    ... input value at observation i - 1
+  // tmp           ... time difference between observation i - 1 and i divided by the half-life of the EMA kernel
+  // interpolation ... sample path interpolation method of the first stage
+  
+  double w, w2, prev, cur;
+  
+  w = exp(-tmp);
+  if (tmp > 1e-6)
+    w2 = (1 - w) / tmp;
+  else {
+    // Use Taylor expansion for numerical stability
+    w2 = 1 - tmp/2 + tmp*tmp/6 - tmp*tmp*tmp/24;
+  }
+  
+  // First stage
+  prev = ema[0];
+  if (interpolation == EMA_LINEAR)
+    ema[0] = ema[0] * w + value * (1 - w2) + value_prev * (w2 - w);
+  else if (interpolation == EMA_NEXT)
+    ema[0] = ema[0] * w + value * (1-w);
+  else
+    ema[0] = ema[0] * w + value_prev * (1-w);
+  
+  // Later stages, where 'prev' is the value of the previous stage at observation i - 1
+  for (int j = 1; j < k; j++) {
+    cur = ema[j] * w + ema[j-1] * (1 - w2) + prev * (w2 - w);
+    prev = ema[j];
+    ema[j] = cur;
+  }
+}
+
+
+// Linear combination sum_j weights[j] * EMA(X, tau, j+1) of iterated EMAs
+void ema_iterated_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *tau, const int *interpolation, const double weights[], const int *k)
+{
+  // values        ... array of time series values
+  // times         ... array of observation times
+  // n             ... number of observations, i.e. length of 'values' and 'times'
+  // values_new    ... array of length *n to store output time series values
+  // tau           ... (positive) half-life of EMA kernel
+  // interpolation ... sample path interpolation method of the first stage (see enum ema_interpolation)
+  // weights       ... array of length *k of weights of the iterated EMAs
+  // k             ... number of iterations, i.e. length of 'weights'
+  
+  double out;
+  int j;
+  
+  // Trivial case
+  if ((*n == 0) || (*k <= 0))
+    return;
+  
+  // Initialize iterated EMAs
+  double *ema = INSTRUMENT_MALLOC(*k * sizeof(double));
+  out = 0;
+  for (j = 0; j < *k; j++) {
+    ema[j] = values[0];
+    out += weights[j] * ema[j];
+  }
+  values_new[0] = out;
+  
+  // Calculate iterated EMAs recursively
+  for (ptrdiff_t i = 1; i < *n; i++) {
+    ema_iterated_step(ema, *k, values[i], values[i-1], (times[i] - times[i-1]) / *tau, *interpolation);
+    out = 0;
+    for (j = 0; j < *k; j++)
+      out += weights[j] * ema[j];
+    values_new[i] = out;
+  }
+  free(ema);
+}
+
+
+// Variance MA((X - MA)^2) of a time series around a linear combination MA = sum_j weights[j] * EMA(X, tau, j+1) of
+// iterated EMAs, where the outer operator uses the same weights and iterated EMAs as MA
+void ema_iterated_var_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *tau, const int *interpolation, const double weights[], const int *k)
+{
+  // values        ... array of time series values
+  // times         ... array of observation times
+  // n             ... number of observations, i.e. length of 'values' and 'times'
+  // values_new    ... array of length *n to store output time series values
+  // tau           ... (positive) half-life of EMA kernel
+  // interpolation ... sample path interpolation method of the first stage (see enum ema_interpolation)
+  // weights       ... array of length *k of weights of the iterated EMAs
+  // k             ... number of iterations, i.e. length of 'weights'
+  
+  double tmp, mean, dev, dev_prev, out;
+  int j;
+  
+  // Trivial case
+  if ((*n == 0) || (*k <= 0))
+    return;
+  
+  // Initialize iterated EMAs of the time series (first half of array) and of the squared deviations (second half)
+  double *ema = INSTRUMENT_MALLOC(2 * *k * sizeof(double));
+  double *ema_dev = ema + *k;
+  mean = 0;
+  for (j = 0; j < *k; j++) {
+    ema[j] = values[0];
+    mean += weights[j] * ema[j];
+  }
+  dev_prev = (values[0] - mean) * (values[0] - mean);
+  out = 0;
+  for (j = 0; j < *k; j++) {
+    ema_dev[j] = dev_prev;
+    out += weights[j] * ema_dev[j];
+  }
+  values_new[0] = out;
+  
+  // Calculate iterated EMAs recursively
+  for (ptrdiff_t i = 1; i < *n; i++) {
+    tmp = (times[i] - times[i-1]) / *tau;
+    ema_iterated_step(ema, *k, values[i], values[i-1], tmp, *interpolation);
+    mean = 0;
+    for (j = 0; j < *k; j++)
+      mean += weights[j] * ema[j];
+    dev = (values[i] - mean) * (values[i] - mean);
+    
+    ema_iterated_step(ema_dev, *k, dev, dev_prev, tmp, *interpolation);
+    out = 0;
+    for (j = 0; j < *k; j++)
+      out += weights[j] * ema_dev[j];
+    values_new[i] = out;
+    dev_prev = dev;
+  }
+  free(ema);
+}
+
+
+
+/************ Versions with output at arbitrary query times ************/
+// -) the output values are EMA(X, tau) at the non-decreasing query times query_times[0], ..., query_times[*m - 1],
+//    which do not need to coincide with observation times, so that no resampled time series needs to be created
+// -) the query times and observation times are merged in a single pass. The EMA is updated at each observation time
+//    with the same order of floating-point operations as the serial kernels, and then advanced along the sample path
+//    from the last observation time to the query time. The output at an observation time is therefore identical to
+//    the output of the serial kernel.
+// -) the sample path is constant before the first and after the last observation
+
+
+// Calculate the weight of the two adjacent observation values in the update of EMA_lin
+static inline double ema_linear_weight(double tmp, double w)
+{
+  // tmp ... time difference divided by the half-life of the EMA kernel
+  // w   ... exp(-tmp)
+  
+  if (tmp > 1e-6)
+    return (1 - w) / tmp;
+  
+  // Use Taylor expansion for numerical stability
+  return 1 - tmp/2 + tmp*tmp/6 - tmp*tmp*tmp/24;
+}
+
+
+// EMA at query times
+static void ema_query(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *tau, enum ema_interpolation interpolation, const double query_times[], const ptrdiff_t *m)
+{
+  // values        ... array of time series values
+  // times         ... array of observation times
+  // n             ... number of observations, i.e. length of 'values' and 'times'
+  // values_new    ... array of length *m to store output time series values
+  // tau           ... (positive) half-life of EMA kernel
+  // interpolation ... sample path interpolation method
+  // query_times   ... array of non-decreasing query times
+  // m             ... number of query times, i.e. length of 'query_times'
+  
+  ptrdiff_t i = 0;
+  double w, w2, tmp, ema, lambda, value;
+  
+  // Trivial case
+  if (*n == 0)
+    return;
+  
+  ema = values[0];
+  for (ptrdiff_t q = 0; q < *m; q++) {
+    // Update the EMA for all observations up to the query time
+    while ((i < *n - 1) && (times[i+1] <= query_times[q])) {
+      i++;
+      tmp = (times[i] - times[i-1]) / *tau;
+      w = exp(-tmp);
+      if (interpolation == EMA_LINEAR) {
+        w2 = ema_linear_weight(tmp, w);
+        ema = ema * w + values[i] * (1 - w2) + values[i-1] * (w2 - w);
+      } else
+        ema = ema * w + values[interpolation == EMA_NEXT ? i : i-1] * (1-w);
+    }
+    
+    // Query time before the first observation time or at an observation time
+    if (query_times[q] <= times[i]) {
+      values_new[q] = ema;
+      continue;
+    }
+    
+    // Advance the EMA from the last observation time to the query time
+    tmp = (query_times[q] - times[i]) / *tau;
+    w = exp(-tmp);
+    if (interpolation == EMA_LINEAR) {
+      // Sample path value at the query time
+      value = values[i];
+      if (i < *n - 1) {
+        lambda = (query_times[q] - times[i]) / (times[i+1] - times[i]);
+        value = values[i] * (1 - lambda) + values[i+1] * lambda;
+      }
+      w2 = ema_linear_weight(tmp, w);
+      values_new[q] = ema * w + value * (1 - w2) + values[i] * (w2 - w);
+    } else if (interpolation == EMA_NEXT)
+      values_new[q] = ema * w + values[MIN(i+1, *n-1)] * (1-w);
+    else
+      values_new[q] = ema * w + values[i] * (1-w);
+  }
+}
+
+
+// EMA_next(X, tau) at query times
+void ema_next_query_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *tau, const double query_times[], const ptrdiff_t *m)
+{
+  // values      ... array of time series values
+  // times       ... array of observation times
+  // n           ... number of observations, i.e. length of 'values' and 'times'
+  // values_new  ... array of length *m to store output time series values
+  // tau         ... (positive) half-life of EMA kernel
+  // query_times ... array of non-decreasing query times
+  // m           ... number of query times, i.e. length of 'query_times'
+  
+  ema_query(values, times, n, values_new, tau, EMA_NEXT, query_times, m);
+}
+
+
+// EMA_last(X, tau) at query times
+void ema_last_query_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *tau, const double query_times[], const ptrdiff_t *m)
+{
+  // values      ... array of time series values
+  // times       ... array of observation times
+  // n           ... number of observations, i.e. length of 'values' and 'times'
+  // values_new  ... array of length *m to store output time series values
+  // tau         ... (positive) half-life of EMA kernel
+  // query_times ... array of non-decreasing query times
+  // m           ... number of query times, i.e. length of 'query_times'
+  
+  ema_query(values, times, n, values_new, tau, EMA_LAST, query_times, m);
+}
+
+
+// EMA_lin(X, tau) at query times
+void ema_linear_query_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *tau, const double query_times[], const ptrdiff_t *m)
+{
+  // values      ... array of time series values
+  // times       ... array of observation times
+  // n           ... number of observations, i.e. length of 'values' and 'times'
+  // values_new  ... array of length *m to store output time series values
+  // tau         ... (positive) half-life of EMA kernel
+  // query_times ... array of non-decreasing query times
+  // m           ... number of query times, i.e. length of 'query_times'
+  
+  ema_query(values, times, n, values_new, tau, EMA_LINEAR, query_times, m);
+}
+
+
+
+/************ Versions with 32-bit lengths ************/
+
+void ema_next(const double values[], const double times[], const int *n, double values_new[], const double *tau)
+{
+  ptrdiff_t n_long = *n;
+  ema_next_long(values, times, &n_long, values_new, tau);
+}
+
+
+void ema_last(const double values[], const double times[], const int *n, double values_new[], const double *tau)
+{
+  ptrdiff_t n_long = *n;
+  ema_last_long(values, times, &n_long, values_new, tau);
+}
+
+
+void ema_linear(const double values[], const double times[], const int *n, double values_new[], const double *tau)
+{
+  ptrdiff_t n_long = *n;
+  ema_linear_long(values, times, &n_long, values_new, tau);
+}
+
+
+void ema_next_batch(const double values[], const double times[], const int *n, double values_new[], const double *tau,
+  const int *num_cols)
+{
+  ptrdiff_t n_long = *n;
+  ema_next_batch_long(values, times, &n_long, values_new, tau, num_cols);
+}
+
+
+void ema_last_batch(const double values[], const double times[], const int *n, double values_new[], const double *tau,
+  const int *num_cols)
+{
+  ptrdiff_t n_long = *n;
+  ema_last_batch_long(values, times, &n_long, values_new, tau, num_cols);
+}
+
+
+void ema_linear_batch(const double values[], const double times[], const int *n, double values_new[], const double *tau,
+  const int *num_cols)
+{
+  ptrdiff_t n_long = *n;
+  ema_linear_batch_long(values, times, &n_long, values_new, tau, num_cols);
+}
+
+
+void ema_next_bank(const double values[], const double times[], const int *n, double values_new[], const double tau[],
+  const int *num_taus)
+{
+  ptrdiff_t n_long = *n;
+  ema_next_bank_long(values, times, &n_long, values_new, tau, num_taus);
+}
+
+
+void ema_last_bank(const double values[], const double times[], const int *n, double values_new[], const double tau[],
+  const int *num_taus)
+{
+  ptrdiff_t n_long = *n;
+  ema_last_bank_long(values, times, &n_long, values_new, tau, num_taus);
+}
+
+
+void ema_linear_bank(const double values[], const double times[], const int *n, double values_new[], const double tau[],
+  const int *num_taus)
+{
+  ptrdiff_t n_long = *n;
+  ema_linear_bank_long(values, times, &n_long, values_new, tau, num_taus);
+}
+
+
+void ema_next_parallel(const double values[], const double times[], const int *n, double values_new[],
+  const double *tau, const int *num_threads)
+{
+  ptrdiff_t n_long = *n;
+  ema_next_parallel_long(values, times, &n_long, values_new, tau, num_threads);
+}
+
+
+void ema_last_parallel(const double values[], const double times[], const int *n, double values_new[],
+  const double *tau, const int *num_threads)
+{
+  ptrdiff_t n_long = *n;
+  ema_last_parallel_long(values, times, &n_long, values_new, tau, num_threads);
+}
+
+
+void ema_linear_parallel(const double values[], const double times[], const int *n, double values_new[],
+  const double *tau, const int *num_threads)
+{
+  ptrdiff_t n_long = *n;
+  ema_linear_parallel_long(values, times, &n_long, values_new, tau, num_threads);
+}
+
+
+void ema_iterated(const double values[], const double times[], const int *n, double values_new[], const double *tau,
+  const int *interpolation, const double weights[], const int *k)
+{
+  ptrdiff_t n_long = *n;
+  ema_iterated_long(values, times, &n_long, values_new, tau, interpolation, weights, k);
+}
+
+
+void ema_iterated_var(const double values[], const double times[], const int *n, double values_new[],
+  const double *tau, const int *interpolation, const double weights[], const int *k)
+{
+  ptrdiff_t n_long = *n;
+  ema_iterated_var_long(values, times, &n_long, values_new, tau, interpolation, weights, k);
+}
+
+
+void ema_next_query(const double values[], const double times[], const int *n, double values_new[],
+  const double *tau, const double query_times[], const int *m)
+{
+  ptrdiff_t n_long = *n, m_long = *m;
+  ema_next_query_long(values, times, &n_long, values_new, tau, query_times, &m_long);
+}
+
+
+void ema_last_query(const double values[], const double times[], const int *n, double values_new[],
+  const double *tau, const double query_times[], const int *m)
+{
+  ptrdiff_t n_long = *n, m_long = *m;
+  ema_last_query_long(values, times, &n_long, values_new, tau, query_times, &m_long);
+}
+
+
+void ema_linear_query(const double values[], const double times[], const int *n, double values_new[],
+  const double *tau, const double query_times[], const int *m)
+{
+  ptrdiff_t n_long = *n, m_long = *m;
+  ema_linear_query_long(values, times, &n_long, values_new, tau, query_times, &m_long);
+}
+
+
+void ema_next_reverse(const double values[], const double times[], const int *n, double values_new[],
+  const double *tau)
+{
+  ptrdiff_t n_long = *n;
+  ema_next_reverse_long(values, times, &n_long, values_new, tau);
+}
+
+
+void ema_last_reverse(const double values[], const double times[], const int *n, double values_new[],
+  const double *tau)
+{
+  ptrdiff_t n_long = *n;
+  ema_last_reverse_long(values, times, &n_long, values_new, tau);
+}
+
+
+void ema_linear_reverse(const double values[], const double times[], const int *n, double values_new[],
+  const double *tau)
+{
+  ptrdiff_t n_long = *n;
+  ema_linear_reverse_long(values, times, &n_long, values_new, tau);
+}
+
+
+void ema_next_reverse_bank(const double values[], const double times[], const int *n, double values_new[],
+  const double tau[], const int *num_taus)
+{
+  ptrdiff_t n_long = *n;
+  ema_next_reverse_bank_long(values, times, &n_long, values_new, tau, num_taus);
+}
+
+
+void ema_last_reverse_bank(const double values[], const double times[], const int *n, double values_new[],
+  const double tau[], const int *num_taus)
+{
+  ptrdiff_t n_long = *n;
+  ema_last_reverse_bank_long(values, times, &n_long, values_new, tau, num_taus);
+}
+
+
+void ema_linear_reverse_bank(const double values[], const double times[], const int *n, double values_new[],
+  const double tau[], const int *num_taus)
+{
+  ptrdiff_t n_long = *n;
+  ema_linear_reverse_bank_long(values, times, &n_long, values_new, tau, num_taus);
+}
+
+
+void ema_next_reverse_parallel(const double values[], const double times[], const int *n, double values_new[],
+  const double *tau, const int *num_threads)
+{
+  ptrdiff_t n_long = *n;
+  ema_next_reverse_parallel_long(values, times, &n_long, values_new, tau, num_threads);
+}
+
+
+void ema_last_reverse_parallel(const double values[], const double times[], const int *n, double values_new[],
+  const double *tau, const int *num_threads)
+{
+  ptrdiff_t n_long = *n;
+  ema_last_reverse_parallel_long(values, times, &n_long, values_new, tau, num_threads);
+}
+
+
+void ema_linear_reverse_parallel(const double values[], const double times[], const int *n, double values_new[],
+  const double *tau, const int *num_threads)
+{
+  ptrdiff_t n_long = *n;
+  ema_linear_reverse_parallel_long(values, times, &n_long, values_new, tau, num_threads);
 }
@@ -1,12 +1,164 @@
 // Copyright: 2012-2018 by Andreas Eckner
 // License: GPL-2 | GPL-3
-// Remark: To facilitate interfaces to other programming languages such as R, all variables are either pointers or arrays
+// Remark: To facilitate interfaces to other programming languages such as R, all variables are either pointers or arrays.
+//         The number of observations has type ptrdiff_t to support long vectors (more than 2^31 - 1 elements) in R,
+//         and the functions without suffix "_long" are thin wrappers for callers with 32-bit lengths.
 
 #ifndef _ema_h
 #define _ema_h
 
+#include <stddef.h>
+
+// Sample path interpolation methods, e.g. for the first stage of iterated EMAs
+enum ema_interpolation {EMA_LAST = 0, EMA_NEXT = 1, EMA_LINEAR = 2};
+
+void ema_next_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *tau);
+void ema_last_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *tau);
+void ema_linear_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *tau);
+
+// Batch versions for several time series with identical observation times, stored in row-major order
+void ema_next_batch_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *tau, const int *num_cols);
+void ema_last_batch_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *tau, const int *num_cols);
+void ema_linear_batch_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *tau, const int *num_cols);
+
+// EMA banks for several half-lives, output stored in column-major order
+void ema_next_bank_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double tau[], const int *num_taus);
+void ema_last_bank_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double tau[], const int *num_taus);
+void ema_linear_bank_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double tau[], const int *num_taus);
+
+// Forward-looking EMAs with half-life -tau < 0, calculated by a reverse scan from the last to the first observation
+void ema_next_reverse_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *tau);
+void ema_last_reverse_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *tau);
+void ema_linear_reverse_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *tau);
+void ema_next_reverse_bank_long(const double values[], const double times[], const ptrdiff_t *n,
+  double values_new[], const double tau[], const int *num_taus);
+void ema_last_reverse_bank_long(const double values[], const double times[], const ptrdiff_t *n,
+  double values_new[], const double tau[], const int *num_taus);
+void ema_linear_reverse_bank_long(const double values[], const double times[], const ptrdiff_t *n,
+  double values_new[], const double tau[], const int *num_taus);
+void ema_next_reverse_parallel_long(const double values[], const double times[], const ptrdiff_t *n,
+  double values_new[], const double *tau, const int *num_threads);
+void ema_last_reverse_parallel_long(const double values[], const double times[], const ptrdiff_t *n,
+  double values_new[], const double *tau, const int *num_threads);
+void ema_linear_reverse_parallel_long(const double values[], const double times[], const ptrdiff_t *n,
+  double values_new[], const double *tau, const int *num_threads);
+
+// Multi-threaded versions (parallel scan over affine EMA steps)
+void ema_next_parallel_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *tau, const int *num_threads);
+void ema_last_parallel_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *tau, const int *num_threads);
+void ema_linear_parallel_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *tau, const int *num_threads);
+
+// Iterated EMAs with a common half-life, combined linearly with the given weights
+void ema_iterated_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *tau, const int *interpolation, const double weights[], const int *k);
+void ema_iterated_var_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *tau, const int *interpolation, const double weights[], const int *k);
+
+// Versions with output at arbitrary non-decreasing query times, output stored in array of length *m
+void ema_next_query_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *tau, const double query_times[], const ptrdiff_t *m);
+void ema_last_query_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *tau, const double query_times[], const ptrdiff_t *m);
+void ema_linear_query_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *tau, const double query_times[], const ptrdiff_t *m);
+
+// Single-precision versions with float observation values and output values, but double observation times
+void ema_next_float_long(const float values[], const double times[], const ptrdiff_t *n, float values_new[],
+  const double *tau);
+void ema_last_float_long(const float values[], const double times[], const ptrdiff_t *n, float values_new[],
+  const double *tau);
+void ema_linear_float_long(const float values[], const double times[], const ptrdiff_t *n, float values_new[],
+  const double *tau);
+
+// Versions with 32-bit lengths
 void ema_next(const double values[], const double times[], const int *n, double values_new[], const double *tau);
+
 void ema_last(const double values[], const double times[], const int *n, double values_new[], const double *tau);
+
 void ema_linear(const double values[], const double times[], const int *n, double values_new[], const double *tau);
 
+void ema_next_batch(const double values[], const double times[], const int *n, double values_new[], const double *tau,
+  const int *num_cols);
+
+void ema_last_batch(const double values[], const double times[], const int *n, double values_new[], const double *tau,
+  const int *num_cols);
+
+void ema_linear_batch(const double values[], const double times[], const int *n, double values_new[], const double *tau,
+  const int *num_cols);
+
+void ema_next_bank(const double values[], const double times[], const int *n, double values_new[], const double tau[],
+  const int *num_taus);
+
+void ema_last_bank(const double values[], const double times[], const int *n, double values_new[], const double tau[],
+  const int *num_taus);
+
+void ema_linear_bank(const double values[], const double times[], const int *n, double values_new[], const double tau[],
+  const int *num_taus);
+
+void ema_next_parallel(const double values[], const double times[], const int *n, double values_new[],
+  const double *tau, const int *num_threads);
+
+void ema_last_parallel(const double values[], const double times[], const int *n, double values_new[],
+  const double *tau, const int *num_threads);
+
+void ema_linear_parallel(const double values[], const double times[], const int *n, double values_new[],
+  const double *tau, const int *num_threads);
+
+void ema_iterated(const double values[], const double times[], const int *n, double values_new[], const double *tau,
+  const int *interpolation, const double weights[], const int *k);
+
+void ema_iterated_var(const double values[], const double times[], const int *n, double values_new[],
+  const double *tau, const int *interpolation, const double weights[], const int *k);
+
+void ema_next_query(const double values[], const double times[], const int *n, double values_new[],
+  const double *tau, const double query_times[], const int *m);
+
+void ema_last_query(const double values[], const double times[], const int *n, double values_new[],
+  const double *tau, const double query_times[], const int *m);
+
+void ema_linear_query(const double values[], const double times[], const int *n, double values_new[],
+  const double *tau, const double query_times[], const int *m);
+
+void ema_next_reverse(const double values[], const double times[], const int *n, double values_new[],
+  const double *tau);
+
+void ema_last_reverse(const double values[], const double times[], const int *n, double values_new[],
+  const double *tau);
+
+void ema_linear_reverse(const double values[], const double times[], const int *n, double values_new[],
+  const double *tau);
+
+void ema_next_reverse_bank(const double values[], const double times[], const int *n, double values_new[],
+  const double tau[], const int *num_taus);
+
+void ema_last_reverse_bank(const double values[], const double times[], const int *n, double values_new[],
+  const double tau[], const int *num_taus);
+
+void ema_linear_reverse_bank(const double values[], const double times[], const int *n, double values_new[],
+  const double tau[], const int *num_taus);
+
+void ema_next_reverse_parallel(const double values[], const double times[], const int *n, double values_new[],
+  const double *tau, const int *num_threads);
+
+void ema_last_reverse_parallel(const double values[], const double times[], const int *n, double values_new[],
+  const double *tau, const int *num_threads);
+
+void ema_linear_reverse_parallel(const double values[], const double times[], const int *n, double values_new[],
+  const double *tau, const int *num_threads);
+
 #endif
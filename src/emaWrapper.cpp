@@ -9,11 +9,11 @@ extern "C" {
 Rcpp::NumericVector Rcpp_wrapper_ema_last(const Rcpp::NumericVector& values, const Rcpp::DatetimeVector& times, double tau)
 {
   // Allocate memory for output
-  int n = values.size();
+  ptrdiff_t n = values.size();
   Rcpp::NumericVector res(n);
   
   // Call C function
-  ema_last(values.begin(), times.begin(), &n, res.begin(), &tau);
+  ema_last_long(values.begin(), times.begin(), &n, res.begin(), &tau);
   return res;
 }
 
@@ -22,11 +22,11 @@ Rcpp::NumericVector Rcpp_wrapper_ema_last(const Rcpp::NumericVector& values, con
 Rcpp::NumericVector Rcpp_wrapper_ema_linear(const Rcpp::NumericVector& values, const Rcpp::DatetimeVector& times, double tau)
 {
   // Allocate memory for output
-  int n = values.size();
+  ptrdiff_t n = values.size();
   Rcpp::NumericVector res(n);
   
   // Call C function
-  ema_linear(values.begin(), times.begin(), &n, res.begin(), &tau);
+  ema_linear_long(values.begin(), times.begin(), &n, res.begin(), &tau);
   return res;
 }
 
@@ -35,11 +35,352 @@ Rcpp::NumericVector Rcpp_wrapper_ema_linear(const Rcpp::NumericVector& values, c
 Rcpp::NumericVector Rcpp_wrapper_ema_next(const Rcpp::NumericVector& values, const Rcpp::DatetimeVector& times, double tau)
 {
   // Allocate memory for output
-  int n = values.size();
+  ptrdiff_t n = values.size();
   Rcpp::NumericVector res(n);
   
   // Call C function
-  ema_next(values.begin(), times.begin(), &n, res.begin(), &tau);
+  ema_next_long(values.begin(), times.begin(), &n, res.begin(), &tau);
   return res;
 }
 
+
+// [[Rcpp::export]]
+Rcpp::NumericMatrix Rcpp_wrapper_ema_last_batch(const Rcpp::NumericMatrix& values, const Rcpp::DatetimeVector& times,
+  double tau)
+{
+  // Allocate memory for output
+  ptrdiff_t n = values.ncol();
+  int num_cols = values.nrow();
+  Rcpp::NumericMatrix res(num_cols, n);
+  if (times.size() != n)
+    Rcpp::stop("The number of columns of 'values' and the length of 'times' need to match");
+  
+  // Call C function
+  ema_last_batch_long(values.begin(), times.begin(), &n, res.begin(), &tau, &num_cols);
+  return res;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::NumericMatrix Rcpp_wrapper_ema_linear_batch(const Rcpp::NumericMatrix& values, const Rcpp::DatetimeVector& times,
+  double tau)
+{
+  // Allocate memory for output
+  ptrdiff_t n = values.ncol();
+  int num_cols = values.nrow();
+  Rcpp::NumericMatrix res(num_cols, n);
+  if (times.size() != n)
+    Rcpp::stop("The number of columns of 'values' and the length of 'times' need to match");
+  
+  // Call C function
+  ema_linear_batch_long(values.begin(), times.begin(), &n, res.begin(), &tau, &num_cols);
+  return res;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::NumericMatrix Rcpp_wrapper_ema_next_batch(const Rcpp::NumericMatrix& values, const Rcpp::DatetimeVector& times,
+  double tau)
+{
+  // Allocate memory for output
+  ptrdiff_t n = values.ncol();
+  int num_cols = values.nrow();
+  Rcpp::NumericMatrix res(num_cols, n);
+  if (times.size() != n)
+    Rcpp::stop("The number of columns of 'values' and the length of 'times' need to match");
+  
+  // Call C function
+  ema_next_batch_long(values.begin(), times.begin(), &n, res.begin(), &tau, &num_cols);
+  return res;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::NumericMatrix Rcpp_wrapper_ema_last_bank(const Rcpp::NumericVector& values, const Rcpp::DatetimeVector& times,
+  const Rcpp::NumericVector& tau)
+{
+  // Allocate memory for output
+  ptrdiff_t n = values.size();
+  int num_taus = tau.size();
+  Rcpp::NumericMatrix res(n, num_taus);
+  
+  // Call C function
+  ema_last_bank_long(values.begin(), times.begin(), &n, res.begin(), tau.begin(), &num_taus);
+  return res;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::NumericMatrix Rcpp_wrapper_ema_linear_bank(const Rcpp::NumericVector& values, const Rcpp::DatetimeVector& times,
+  const Rcpp::NumericVector& tau)
+{
+  // Allocate memory for output
+  ptrdiff_t n = values.size();
+  int num_taus = tau.size();
+  Rcpp::NumericMatrix res(n, num_taus);
+  
+  // Call C function
+  ema_linear_bank_long(values.begin(), times.begin(), &n, res.begin(), tau.begin(), &num_taus);
+  return res;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::NumericMatrix Rcpp_wrapper_ema_next_bank(const Rcpp::NumericVector& values, const Rcpp::DatetimeVector& times,
+  const Rcpp::NumericVector& tau)
+{
+  // Allocate memory for output
+  ptrdiff_t n = values.size();
+  int num_taus = tau.size();
+  Rcpp::NumericMatrix res(n, num_taus);
+  
+  // Call C function
+  ema_next_bank_long(values.begin(), times.begin(), &n, res.begin(), tau.begin(), &num_taus);
+  return res;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::NumericVector Rcpp_wrapper_ema_last_parallel(const Rcpp::NumericVector& values, const Rcpp::DatetimeVector& times,
+  double tau, int num_threads)
+{
+  // Allocate memory for output
+  ptrdiff_t n = values.size();
+  Rcpp::NumericVector res(n);
+  
+  // Call C function
+  ema_last_parallel_long(values.begin(), times.begin(), &n, res.begin(), &tau, &num_threads);
+  return res;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::NumericVector Rcpp_wrapper_ema_linear_parallel(const Rcpp::NumericVector& values, const Rcpp::DatetimeVector& times,
+  double tau, int num_threads)
+{
+  // Allocate memory for output
+  ptrdiff_t n = values.size();
+  Rcpp::NumericVector res(n);
+  
+  // Call C function
+  ema_linear_parallel_long(values.begin(), times.begin(), &n, res.begin(), &tau, &num_threads);
+  return res;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::NumericVector Rcpp_wrapper_ema_next_parallel(const Rcpp::NumericVector& values, const Rcpp::DatetimeVector& times,
+  double tau, int num_threads)
+{
+  // Allocate memory for output
+  ptrdiff_t n = values.size();
+  Rcpp::NumericVector res(n);
+  
+  // Call C function
+  ema_next_parallel_long(values.begin(), times.begin(), &n, res.begin(), &tau, &num_threads);
+  return res;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::NumericVector Rcpp_wrapper_ema_iterated(const Rcpp::NumericVector& values, const Rcpp::DatetimeVector& times,
+  double tau, int interpolation, const Rcpp::NumericVector& weights)
+{
+  // Allocate memory for output
+  ptrdiff_t n = values.size();
+  int k = weights.size();
+  Rcpp::NumericVector res(n);
+  
+  // Call C function
+  ema_iterated_long(values.begin(), times.begin(), &n, res.begin(), &tau, &interpolation, weights.begin(), &k);
+  return res;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::NumericVector Rcpp_wrapper_ema_iterated_var(const Rcpp::NumericVector& values,
+  const Rcpp::DatetimeVector& times, double tau, int interpolation, const Rcpp::NumericVector& weights)
+{
+  // Allocate memory for output
+  ptrdiff_t n = values.size();
+  int k = weights.size();
+  Rcpp::NumericVector res(n);
+  
+  // Call C function
+  ema_iterated_var_long(values.begin(), times.begin(), &n, res.begin(), &tau, &interpolation, weights.begin(), &k);
+  return res;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::NumericVector Rcpp_wrapper_ema_last_query(const Rcpp::NumericVector& values, const Rcpp::DatetimeVector& times,
+  double tau, const Rcpp::DatetimeVector& query_times)
+{
+  // Allocate memory for output
+  ptrdiff_t n = values.size();
+  ptrdiff_t m = query_times.size();
+  Rcpp::NumericVector res(m);
+  
+  // Call C function
+  ema_last_query_long(values.begin(), times.begin(), &n, res.begin(), &tau, query_times.begin(), &m);
+  return res;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::NumericVector Rcpp_wrapper_ema_linear_query(const Rcpp::NumericVector& values, const Rcpp::DatetimeVector& times,
+  double tau, const Rcpp::DatetimeVector& query_times)
+{
+  // Allocate memory for output
+  ptrdiff_t n = values.size();
+  ptrdiff_t m = query_times.size();
+  Rcpp::NumericVector res(m);
+  
+  // Call C function
+  ema_linear_query_long(values.begin(), times.begin(), &n, res.begin(), &tau, query_times.begin(), &m);
+  return res;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::NumericVector Rcpp_wrapper_ema_next_query(const Rcpp::NumericVector& values, const Rcpp::DatetimeVector& times,
+  double tau, const Rcpp::DatetimeVector& query_times)
+{
+  // Allocate memory for output
+  ptrdiff_t n = values.size();
+  ptrdiff_t m = query_times.size();
+  Rcpp::NumericVector res(m);
+  
+  // Call C function
+  ema_next_query_long(values.begin(), times.begin(), &n, res.begin(), &tau, query_times.begin(), &m);
+  return res;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::NumericVector Rcpp_wrapper_ema_last_reverse(const Rcpp::NumericVector& values, const Rcpp::DatetimeVector& times,
+  double tau)
+{
+  // Allocate memory for output
+  ptrdiff_t n = values.size();
+  Rcpp::NumericVector res(n);
+  
+  // Call C function
+  ema_last_reverse_long(values.begin(), times.begin(), &n, res.begin(), &tau);
+  return res;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::NumericVector Rcpp_wrapper_ema_linear_reverse(const Rcpp::NumericVector& values,
+  const Rcpp::DatetimeVector& times, double tau)
+{
+  // Allocate memory for output
+  ptrdiff_t n = values.size();
+  Rcpp::NumericVector res(n);
+  
+  // Call C function
+  ema_linear_reverse_long(values.begin(), times.begin(), &n, res.begin(), &tau);
+  return res;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::NumericVector Rcpp_wrapper_ema_next_reverse(const Rcpp::NumericVector& values, const Rcpp::DatetimeVector& times,
+  double tau)
+{
+  // Allocate memory for output
+  ptrdiff_t n = values.size();
+  Rcpp::NumericVector res(n);
+  
+  // Call C function
+  ema_next_reverse_long(values.begin(), times.begin(), &n, res.begin(), &tau);
+  return res;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::NumericMatrix Rcpp_wrapper_ema_last_reverse_bank(const Rcpp::NumericVector& values,
+  const Rcpp::DatetimeVector& times, const Rcpp::NumericVector& tau)
+{
+  // Allocate memory for output
+  ptrdiff_t n = values.size();
+  int num_taus = tau.size();
+  Rcpp::NumericMatrix res(n, num_taus);
+  
+  // Call C function
+  ema_last_reverse_bank_long(values.begin(), times.begin(), &n, res.begin(), tau.begin(), &num_taus);
+  return res;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::NumericMatrix Rcpp_wrapper_ema_linear_reverse_bank(const Rcpp::NumericVector& values,
+  const Rcpp::DatetimeVector& times, const Rcpp::NumericVector& tau)
+{
+  // Allocate memory for output
+  ptrdiff_t n = values.size();
+  int num_taus = tau.size();
+  Rcpp::NumericMatrix res(n, num_taus);
+  
+  // Call C function
+  ema_linear_reverse_bank_long(values.begin(), times.begin(), &n, res.begin(), tau.begin(), &num_taus);
+  return res;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::NumericMatrix Rcpp_wrapper_ema_next_reverse_bank(const Rcpp::NumericVector& values,
+  const Rcpp::DatetimeVector& times, const Rcpp::NumericVector& tau)
+{
+  // Allocate memory for output
+  ptrdiff_t n = values.size();
+  int num_taus = tau.size();
+  Rcpp::NumericMatrix res(n, num_taus);
+  
+  // Call C function
+  ema_next_reverse_bank_long(values.begin(), times.begin(), &n, res.begin(), tau.begin(), &num_taus);
+  return res;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::NumericVector Rcpp_wrapper_ema_last_reverse_parallel(const Rcpp::NumericVector& values,
+  const Rcpp::DatetimeVector& times, double tau, int num_threads)
+{
+  // Allocate memory for output
+  ptrdiff_t n = values.size();
+  Rcpp::NumericVector res(n);
+  
+  // Call C function
+  ema_last_reverse_parallel_long(values.begin(), times.begin(), &n, res.begin(), &tau, &num_threads);
+  return res;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::NumericVector Rcpp_wrapper_ema_linear_reverse_parallel(const Rcpp::NumericVector& values,
+  const Rcpp::DatetimeVector& times, double tau, int num_threads)
+{
+  // Allocate memory for output
+  ptrdiff_t n = values.size();
+  Rcpp::NumericVector res(n);
+  
+  // Call C function
+  ema_linear_reverse_parallel_long(values.begin(), times.begin(), &n, res.begin(), &tau, &num_threads);
+  return res;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::NumericVector Rcpp_wrapper_ema_next_reverse_parallel(const Rcpp::NumericVector& values,
+  const Rcpp::DatetimeVector& times, double tau, int num_threads)
+{
+  // Allocate memory for output
+  ptrdiff_t n = values.size();
+  Rcpp::NumericVector res(n);
+  
+  // Call C function
+  ema_next_reverse_parallel_long(values.begin(), times.begin(), &n, res.begin(), &tau, &num_threads);
+  return res;
+}
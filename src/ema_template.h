@@ -0,0 +1,93 @@
+// Copyright: 2012-2018 by Andreas Eckner
+// License: GPL-2 | GPL-3
+// Remark: Exponential moving averages for a generic type of observation values, i.e. a template in C. This file is
+//         included by ema.c once for each value type, after defining the macros VALUE_TYPE and KERNEL_NAME(name) (see
+//         sma_template.h). The EMA is always calculated recursively in double precision, and only the output is
+//         rounded to the value type.
+//         There is deliberately no include guard.
+
+
+// EMA_next(X, tau)
+void KERNEL_NAME(ema_next)(const VALUE_TYPE values[], const double times[], const ptrdiff_t *n,
+  VALUE_TYPE values_new[], const double *tau)
+{
+  // values     ... array of time series values
+  // times      ... array of observation times
+  // n          ... number of observations, i.e. length of 'values' and 'times'
+  // values_new ... array of length *n to store output time series values
+  // tau        ... (positive) half-life of EMA kernel
+  
+  double w, ema;
+  
+  // Trivial case
+  if (*n == 0)
+    return;
+  
+  // Calculate ema recursively
+  values_new[0] = ema = values[0];
+  for (ptrdiff_t i = 1; i < *n; i++) {
+    w = exp(-(times[i] - times[i-1]) / *tau);
+    ema = ema * w + values[i] * (1-w);
+    values_new[i] = ema;
+  }
+}
+
+
+// EMA_last(X, tau)
+void KERNEL_NAME(ema_last)(const VALUE_TYPE values[], const double times[], const ptrdiff_t *n,
+  VALUE_TYPE values_new[], const double *tau)
+{
+  // values     ... array of time series values
+  // times      ... array of observation times
+  // n          ... number of observations, i.e. length of 'values' and 'times'
+  // values_new ... array of length *n to store output time series values
+  // tau        ... (positive) half-life of EMA kernel
+  
+  double w, ema;
+  
+  // Trivial case
+  if (*n == 0)
+    return;
+  
+  // Calculate ema recursively   
+  values_new[0] = ema = values[0];
+  for (ptrdiff_t i = 1; i < *n; i++) {
+    w = exp(-(times[i] - times[i-1]) / *tau);
+    ema = ema * w + values[i-1] * (1-w);
+    values_new[i] = ema;
+  }
+  
+}
+
+
+// EMA_lin(X, tau)
+void KERNEL_NAME(ema_linear)(const VALUE_TYPE values[], const double times[], const ptrdiff_t *n,
+  VALUE_TYPE values_new[], const double *tau)
+{
+  // values     ... array of time series values
+  // times      ... array of observation times
+  // n          ... number of observations, i.e. length of 'values' and 'times'
+  // values_new ... array of length *n to store output time series values
+  // tau        ... (positive) half-life of EMA kernel
+  
+  double w, w2, tmp, ema;
+  
+  // Trivial case
+  if (*n == 0)
+    return;
+  
+  // Calculate ema recursively   
+  values_new[0] = ema = values[0];   
+  for (ptrdiff_t i = 1; i < *n; i++) {
+    tmp = (times[i] - times[i-1]) / *tau;
+    w = exp(-tmp);
+    if (tmp > 1e-6)
+      w2 = (1 - w) / tmp;
+    else {
+      // Use Taylor expansion for numerical stability
+      w2 = 1 - tmp/2 + tmp*tmp/6 - tmp*tmp*tmp/24;
+    }
+    ema = ema * w + values[i] * (1 - w2) + values[i-1] * (w2 - w);
+    values_new[i] = ema;
+  }
+}
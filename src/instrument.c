@@ -0,0 +1,54 @@
+// Copyright: 2012-2018 by Andreas Eckner
+// License: GPL-2 | GPL-3
+
+#include "instrument.h"
+
+
+kernel_stats instrument_stats = {0, 0, 0, 0, 0};
+
+
+// Reset all counters to zero
+void instrument_reset(void)
+{
+  instrument_stats.expand_steps = 0;
+  instrument_stats.shrink_steps = 0;
+  instrument_stats.rescans = 0;
+  instrument_stats.elements_touched = 0;
+  instrument_stats.alloc_bytes = 0;
+}
+
+
+// Return 1 if the counters are compiled in, and 0 otherwise
+int instrument_enabled(void)
+{
+#ifdef UTS_INSTRUMENT
+  return 1;
+#else
+  return 0;
+#endif
+}
+
+
+#ifdef UTS_INSTRUMENT
+
+// Allocate memory and count the number of allocated bytes
+void *instrument_malloc(size_t size)
+{
+  // size ... number of bytes
+
+  INSTRUMENT_ADD(alloc_bytes, (long long) size);
+  return malloc(size);
+}
+
+
+// Allocate zero-initialized memory and count the number of allocated bytes
+void *instrument_calloc(size_t num, size_t size)
+{
+  // num  ... number of elements
+  // size ... number of bytes per element
+
+  INSTRUMENT_ADD(alloc_bytes, (long long) (num * size));
+  return calloc(num, size);
+}
+
+#endif
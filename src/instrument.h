@@ -0,0 +1,62 @@
+// Copyright: 2012-2018 by Andreas Eckner
+// License: GPL-2 | GPL-3
+// Remark: Optional instrumentation counters for the work done by the rolling window kernels. The counters are only
+//         compiled in if the macro UTS_INSTRUMENT is defined (e.g. by adding -DUTS_INSTRUMENT to PKG_CPPFLAGS in
+//         src/Makevars), so that the default build pays nothing.
+
+#ifndef _instrument_h
+#define _instrument_h
+
+#include <stddef.h>
+#include <stdlib.h>
+
+
+// Work done by the kernels since the last call of instrument_reset()
+typedef struct {
+  long long expand_steps;      // number of times the rolling window was expanded on the right by one observation
+  long long shrink_steps;      // number of times the rolling window was shrunk on the left by one observation
+  long long rescans;           // number of times the window state was recomputed from scratch
+  long long elements_touched;  // number of observations (or data structure nodes) read to maintain the window state
+  long long alloc_bytes;       // number of bytes of heap memory allocated
+} kernel_stats;
+
+extern kernel_stats instrument_stats;
+
+// Reset all counters to zero
+void instrument_reset(void);
+
+// Return 1 if the counters are compiled in, and 0 otherwise
+int instrument_enabled(void);
+
+
+#ifdef UTS_INSTRUMENT
+
+void *instrument_malloc(size_t size);
+void *instrument_calloc(size_t num, size_t size);
+
+#ifdef _OPENMP
+#define INSTRUMENT_ADD(counter, k) do { _Pragma("omp atomic") instrument_stats.counter += (k); } while (0)
+#else
+#define INSTRUMENT_ADD(counter, k) do { instrument_stats.counter += (k); } while (0)
+#endif
+
+// Count the expand and shrink steps of a sweep over the observations, each of which touches one observation
+#define INSTRUMENT_WINDOW(num_expand, num_shrink) do { \
+  INSTRUMENT_ADD(expand_steps, num_expand); \
+  INSTRUMENT_ADD(shrink_steps, num_shrink); \
+  INSTRUMENT_ADD(elements_touched, (num_expand) + (num_shrink)); \
+} while (0)
+
+#define INSTRUMENT_MALLOC(size) instrument_malloc(size)
+#define INSTRUMENT_CALLOC(num, size) instrument_calloc(num, size)
+
+#else
+
+#define INSTRUMENT_ADD(counter, k) ((void) 0)
+#define INSTRUMENT_WINDOW(num_expand, num_shrink) ((void) 0)
+#define INSTRUMENT_MALLOC(size) malloc(size)
+#define INSTRUMENT_CALLOC(num, size) calloc(num, size)
+
+#endif
+
+#endif
@@ -0,0 +1,33 @@
+#include <Rcpp.h>
+
+extern "C" {
+#include "instrument.h"
+}
+
+
+// [[Rcpp::export]]
+bool Rcpp_wrapper_kernel_stats_enabled()
+{
+  return instrument_enabled();
+}
+
+
+// [[Rcpp::export]]
+void Rcpp_wrapper_kernel_stats_reset()
+{
+  instrument_reset();
+}
+
+
+// [[Rcpp::export]]
+Rcpp::List Rcpp_wrapper_kernel_stats()
+{
+  // Use doubles, because the counters can exceed the range of R integers
+  return Rcpp::List::create(
+    Rcpp::Named("expand_steps") = (double) instrument_stats.expand_steps,
+    Rcpp::Named("shrink_steps") = (double) instrument_stats.shrink_steps,
+    Rcpp::Named("rescans") = (double) instrument_stats.rescans,
+    Rcpp::Named("elements_touched") = (double) instrument_stats.elements_touched,
+    Rcpp::Named("alloc_bytes") = (double) instrument_stats.alloc_bytes
+  );
+}
@@ -0,0 +1,45 @@
+// Copyright: 2012-2018 by Andreas Eckner
+// License: GPL-2 | GPL-3
+
+#include "parallel.h"
+
+
+// Apply a rolling window kernel to all output positions, using several threads for long time series
+// -) the output positions are split into equally sized chunks of at least *min_chunk positions, one for each thread
+// -) without OpenMP support, or if there are fewer than 2 * *min_chunk observations, a single thread is used
+void apply_range_kernel(range_kernel kernel, const double values[], const double times[], const ptrdiff_t *n,
+  double values_new[], const double *width_before, const double *width_after, const int *num_threads,
+  const int *min_chunk)
+{
+  // kernel       ... rolling window kernel for a range of output positions
+  // values       ... array of time series values
+  // times        ... array of observation times
+  // n            ... number of observations, i.e. length of 'values' and 'times'
+  // values_new   ... array of length *n to store output time series values
+  // width_before ... (non-negative) width of rolling window before t_i
+  // width_after  ... (non-negative) width of rolling window after t_i
+  // num_threads  ... maximum number of threads to use
+  // min_chunk    ... minimum number of output positions per thread
+  
+  // Determine number of chunks
+  int num_chunks = *num_threads;
+  if ((*min_chunk > 0) && (num_chunks > *n / *min_chunk))
+    num_chunks = *n / *min_chunk;
+#ifndef _OPENMP
+  num_chunks = 1;
+#endif
+  
+  // Serial case
+  if (num_chunks <= 1) {
+    kernel(values, times, n, values_new, width_before, width_after, 0, *n);
+    return;
+  }
+  
+  // Process chunks in parallel
+  #pragma omp parallel for num_threads(num_chunks) schedule(static, 1)
+  for (int c = 0; c < num_chunks; c++) {
+    ptrdiff_t start = *n * c / num_chunks;
+    ptrdiff_t end = *n * (c + 1) / num_chunks;
+    kernel(values, times, n, values_new, width_before, width_after, start, end);
+  }
+}
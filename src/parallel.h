@@ -0,0 +1,57 @@
+// Copyright: 2012-2018 by Andreas Eckner
+// License: GPL-2 | GPL-3
+// Remark: Multi-threaded execution of rolling window kernels, where the output positions are split into chunks and each
+//         thread determines the rolling window for the first position of its chunk by binary search
+
+#ifndef _parallel_h
+#define _parallel_h
+
+#include <stddef.h>
+
+// Kernel that calculates the output values for output positions start, ..., end - 1
+typedef void (*range_kernel)(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after, ptrdiff_t start, ptrdiff_t end);
+
+void apply_range_kernel(range_kernel kernel, const double values[], const double times[], const ptrdiff_t *n,
+  double values_new[], const double *width_before, const double *width_after, const int *num_threads,
+  const int *min_chunk);
+
+
+// Return the index of the first observation time > t (or n, if there is no such observation time)
+static inline ptrdiff_t first_index_after(const double times[], ptrdiff_t n, double t)
+{
+  // times ... array of observation times
+  // n     ... number of observations
+  // t     ... time point
+  
+  ptrdiff_t lo = 0, hi = n;
+  while (lo < hi) {
+    ptrdiff_t mid = lo + (hi - lo) / 2;
+    if (times[mid] <= t)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  return lo;
+}
+
+
+// Return the index of the first observation time >= t (or n, if there is no such observation time)
+static inline ptrdiff_t first_index_at_or_after(const double times[], ptrdiff_t n, double t)
+{
+  // times ... array of observation times
+  // n     ... number of observations
+  // t     ... time point
+  
+  ptrdiff_t lo = 0, hi = n;
+  while (lo < hi) {
+    ptrdiff_t mid = lo + (hi - lo) / 2;
+    if (times[mid] < t)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  return lo;
+}
+
+#endif
@@ -3,507 +3,1141 @@
 
 #include <math.h>
 #include <stdlib.h>
+#include "instrument.h"
 #include "rolling.h"
+#include "rolling_helpers.h"
+#include "skiplist.h"
 
-#ifndef SWAP
-#  define SWAP(a,b) {temp=(a); (a)=(b); (b)=temp;}
-#endif
 
-
-/******************* Helper functions ********************/
-
-// Return smallest element of an array (defined as +infinity for empty array)
-static inline double array_min(const double values[], int n)
+// Rolling sample quantiles for one or more probabilities
+void rolling_quantile_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after, const double probs[], const int *num_probs)
 {
-  // values ... array of values
-  // n      ... length of array
-  
-  double min_value = INFINITY;
+  // values       ... array of time series values
+  // times        ... array of observation times matching time series values
+  // n            ... length of 'values'
+  // values_new   ... array of length *n * *num_probs used to store output, where the output for probs[k] is stored
+  //                  in values_new[k * *n], ..., values_new[(k + 1) * *n - 1]
+  // width_before ... (non-negative) width of rolling window before t_i
+  // width_after  ... (non-negative) width of rolling window after t_i
+  // probs        ... array of probabilities in [0, 1]
+  // num_probs    ... length of 'probs'
   
-  for (int i = 0; i < n; i++) {
-    if (values[i] < min_value)
-      min_value = values[i];
-  }
-  return min_value;
-}
-
-
-/*
-Find the k-th largest element (counting starts at zero) of an array using the "quickselect" algorithm
--) O(N) average case performance
--) the input array will be rearranged
-*/
-double quickselect(double values[], int n, int k)
-{
-  // values ... array of values
-  // n      ... length of array
-  // k      ... return k-th smallest element
-  
-  if (k >= n)
-    return NAN;
-  
-  int i, j, left, right, mid;
-  double pivot, temp;
-  left = 0;
-  right = n - 1;
-  
-  // Loop invariant: values[left] <= k-th largest element of values <= values[right]
-  while (1) {
-    if (right - left <= 1) {
-      // Candidate region down to 1-2 elements
-      if ((right == left + 1) && (values[right] < values[left]))
-        SWAP(values[left], values[right])
-      return values[k];
-    } else {
-      // The pivot element is the second largest value of: values[left], values[mid], values[right]
-      // -) avoids quadractic run-time on some common inputs, without need to pick random element
-      mid = (left + right) / 2;
-      SWAP(values[mid], values[left + 1]);
-      
-      // Sort the three elements from which the pivot is picked
-      if (values[left] > values[right])
-        SWAP(values[left], values[right])
-      if (values[left + 1] > values[right])
-        SWAP(values[left + 1], values[right])
-      if (values[left] > values[left + 1])
-        SWAP(values[left], values[left + 1])
-      pivot = values[left + 1];
-      
-      // Partition the candidate region, i.e. put smaller elements to left of pivot, larger to right
-      // -) the two-sided algorithm avoids quadratic run-time on some common inputs
-      // -) loop invariant: elements <= i are less than the pivot, elements >= j are larger than the pivot
-      // -) see Chapter 11.3 in "Programming Pearls", 2nd edition, by John Bentley
-      i = left + 1;
-      j = right;
-      while (1) {
-        do i++; while (values[i] < pivot);
-        do j--; while (values[j] > pivot);
-        if (j < i)
-          break;
-        SWAP(values[i], values[j])
-      }
-      values[left + 1] = values[j];
-      values[j] = pivot;
-      if (j >= k)
-        right = j-1;
-      if (j <= k)
-        left = i;
+  ptrdiff_t left = 0, right = -1;
+  skiplist *window = skiplist_create();   // sorted observation values in rolling window
+
+  for (ptrdiff_t i = 0; i < *n; i++) {
+    // Expand window on the right
+    while ((right < *n - 1) && (times[right + 1] <= times[i] + *width_after)) {
+      right++;
+      skiplist_insert(window, values[right]);
     }
+    
+    // Shrink window on the left end
+    while ((left < *n) && (times[left] <= times[i] - *width_before)) {
+      skiplist_remove(window, values[left]);
+      left++;
+    }
+    
+    // Calculate all requested quantiles of the sorted window values
+    for (int k = 0; k < *num_probs; k++)
+      values_new[i + k * *n] = skiplist_quantile(window, probs[k]);
   }
+  INSTRUMENT_WINDOW(right + 1, left);
+  skiplist_free(window);
 }
 
 
-// Find the median value of an array (which gets scrambled)
-double median(double values[], int n)
-{
-  // values ... array of values
-  // n      ... length of array
+/************ Batch versions for several time series with identical observation times ************/
+// -) the observation values of the time series are stored in row-major order, i.e. values[k + j * *num_cols] is the
+//    j-th observation value of the k-th time series, and the output is stored in the same way
+// -) the rolling window is determined only once, and the inner loop runs over all time series, i.e. over contiguous
+//    memory, so that it can be vectorized
+
 
-  double value_low, value_high;
+// Rolling maximum of observation values for several time series
+void rolling_max_batch_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_cols)
+{
+  // values       ... array of length *n * *num_cols of time series values
+  // times        ... array of observation times
+  // n            ... number of observations, i.e. length of 'times'
+  // values_new   ... array of length *n * *num_cols to store output time series values
+  // width_before ... (non-negative) width of rolling window before t_i
+  // width_after  ... (non-negative) width of rolling window after t_i
+  // num_cols     ... number of time series
   
-  if (n == 0)
-    return NAN;
+  ptrdiff_t left = 0, right = -1;
+  int k;
+  const double *row;
+  double *row_new;
   
-  // Determine the mid points of the array
-  int mid_low = (n - 1) / 2;
-  int mid_high = n - mid_low - 1;
-  value_low = quickselect(values, n, mid_low);
+  // One monotonic deque (see rolling_max) for each time series, stored in a ring buffer that can hold all positions
+  // inside the time window, together with the values at these positions to avoid strided reads from 'values'
+  const ptrdiff_t mask = ring_buffer_mask(max_window_span(times, *n, *width_before, *width_after));
+  ptrdiff_t *deque = INSTRUMENT_MALLOC((size_t) (mask + 1) * *num_cols * sizeof(ptrdiff_t));
+  double *deque_values = INSTRUMENT_MALLOC((size_t) (mask + 1) * *num_cols * sizeof(double));
+  ptrdiff_t *head = INSTRUMENT_CALLOC(*num_cols, sizeof(ptrdiff_t));
+  ptrdiff_t *tail = INSTRUMENT_CALLOC(*num_cols, sizeof(ptrdiff_t));
   
-  if (mid_low < mid_high) {   // even number of elements -> two mid points
-    // Get the smallest element to the right of lowest mid-point
-    value_high = array_min(values + mid_high, n - mid_high);
-    return (value_low + value_high) / 2; 
-  } else
-    return value_low;
+  for (ptrdiff_t i = 0; i < *n; i++) {
+    // Expand window on the right
+    while ((right < *n - 1) && (times[right + 1] <= times[i] + *width_after)) {
+      right++;
+      row = values + (size_t) right * *num_cols;
+      for (k = 0; k < *num_cols; k++) {
+        ptrdiff_t *deque_k = deque + (size_t) k * (mask + 1);
+        double *deque_values_k = deque_values + (size_t) k * (mask + 1);
+        while ((tail[k] > head[k]) && (deque_values_k[(tail[k] - 1) & mask] <= row[k])) {
+          tail[k]--;
+          INSTRUMENT_ADD(elements_touched, 1);
+        }
+        deque_k[tail[k] & mask] = right;
+        deque_values_k[tail[k]++ & mask] = row[k];
+      }
+    }
+    
+    // Shrink window on the left to get half-open interval
+    while ((left < *n) && (times[left] <= times[i] - *width_before))
+      left++;
+    
+    // Drop positions that are no longer inside the window, and save maximum in current time window
+    row_new = values_new + (size_t) i * *num_cols;
+    for (k = 0; k < *num_cols; k++) {
+      ptrdiff_t *deque_k = deque + (size_t) k * (mask + 1);
+      while ((head[k] < tail[k]) && (deque_k[head[k] & mask] < left)) {
+        head[k]++;
+        INSTRUMENT_ADD(elements_touched, 1);
+      }
+      if (head[k] < tail[k])    // non-empty window
+        row_new[k] = deque_values[(size_t) k * (mask + 1) + (head[k] & mask)];
+      else                      // empty window
+        row_new[k] = -INFINITY;
+    }
+  }
+  INSTRUMENT_WINDOW(right + 1, left);
+  free(deque);
+  free(deque_values);
+  free(head);
+  free(tail);
 }
 
 
-// Compensated addition using Kahan (1965) summation algorithm
-static inline void compensated_addition(double *sum, double addend, double *comp)
+// Rolling average of observation values for several time series
+void rolling_mean_batch_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_cols)
 {
-  // sum    ... sum calculated so far
-  // addend ... value to be added to 'sum'
-  // comp   ... accumulated numeric error so far
+  // values       ... array of length *n * *num_cols of time series values
+  // times        ... array of observation times
+  // n            ... number of observations, i.e. length of 'times'
+  // values_new   ... array of length *n * *num_cols to store output time series values
+  // width_before ... (non-negative) width of rolling window before t_i
+  // width_after  ... (non-negative) width of rolling window after t_i
+  // num_cols     ... number of time series
   
-  double sum_new;
+  ptrdiff_t left = 0, right = -1;
+  int k;
+  const double *row;
+  double *row_new;
+  double *roll_sum = INSTRUMENT_CALLOC(*num_cols, sizeof(double));
   
-  addend = addend - *comp;
-  sum_new = *sum + addend;
-  *comp = (sum_new - *sum) - addend;
-  *sum = sum_new;
+  for (ptrdiff_t i = 0; i < *n; i++) {
+    // Expand window on the right
+    while ((right < *n - 1) && (times[right + 1] <= times[i] + *width_after)) {
+      right++;
+      row = values + (size_t) right * *num_cols;
+      for (k = 0; k < *num_cols; k++)
+        roll_sum[k] = roll_sum[k] + row[k];
+    }
+    
+    // Shrink window on the left to get half-open interval
+    while ((left < *n) && (times[left] <= times[i] - *width_before)) {
+      row = values + (size_t) left * *num_cols;
+      for (k = 0; k < *num_cols; k++)
+        roll_sum[k] = roll_sum[k] - row[k];
+      left++;
+    }
+    
+    // Calculate mean of values in rolling window
+    row_new = values_new + (size_t) i * *num_cols;
+    for (k = 0; k < *num_cols; k++) {
+      if (left <= right)  // non-empty window
+        row_new[k] = roll_sum[k] / (right - left + 1);
+      else                // empty window
+        row_new[k] = NAN;
+    }
+  }
+  INSTRUMENT_WINDOW(right + 1, left);
+  free(roll_sum);
 }
 
 
-
-/****************** END: Helper functions ****************/
-
-
-// Rolling number of observation values
-void rolling_num_obs(const double values[], const double times[], const int *n, double values_new[],
-  const double *width_before, const double *width_after)
+// Rolling minimum of observation values for several time series
+void rolling_min_batch_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_cols)
 {
-  // values       ... array of time series values
+  // values       ... array of length *n * *num_cols of time series values
   // times        ... array of observation times
-  // n            ... number of observations, i.e. length of 'values' and 'times'
-  // values_new   ... array of length *n to store output time series values
+  // n            ... number of observations, i.e. length of 'times'
+  // values_new   ... array of length *n * *num_cols to store output time series values
   // width_before ... (non-negative) width of rolling window before t_i
   // width_after  ... (non-negative) width of rolling window after t_i
+  // num_cols     ... number of time series
+  
+  ptrdiff_t left = 0, right = -1;
+  int k;
+  const double *row;
+  double *row_new;
   
-  int left = 0, right = -1;
+  // One monotonic deque (see rolling_min) for each time series, stored in a ring buffer that can hold all positions
+  // inside the time window, together with the values at these positions to avoid strided reads from 'values'
+  const ptrdiff_t mask = ring_buffer_mask(max_window_span(times, *n, *width_before, *width_after));
+  ptrdiff_t *deque = INSTRUMENT_MALLOC((size_t) (mask + 1) * *num_cols * sizeof(ptrdiff_t));
+  double *deque_values = INSTRUMENT_MALLOC((size_t) (mask + 1) * *num_cols * sizeof(double));
+  ptrdiff_t *head = INSTRUMENT_CALLOC(*num_cols, sizeof(ptrdiff_t));
+  ptrdiff_t *tail = INSTRUMENT_CALLOC(*num_cols, sizeof(ptrdiff_t));
   
-  for (int i = 0; i < *n; i++) {
+  for (ptrdiff_t i = 0; i < *n; i++) {
     // Expand window on the right
-    while ((right < *n - 1) && (times[right + 1] <= times[i] + *width_after))
+    while ((right < *n - 1) && (times[right + 1] <= times[i] + *width_after)) {
       right++;
+      row = values + (size_t) right * *num_cols;
+      for (k = 0; k < *num_cols; k++) {
+        ptrdiff_t *deque_k = deque + (size_t) k * (mask + 1);
+        double *deque_values_k = deque_values + (size_t) k * (mask + 1);
+        while ((tail[k] > head[k]) && (deque_values_k[(tail[k] - 1) & mask] >= row[k])) {
+          tail[k]--;
+          INSTRUMENT_ADD(elements_touched, 1);
+        }
+        deque_k[tail[k] & mask] = right;
+        deque_values_k[tail[k]++ & mask] = row[k];
+      }
+    }
     
-    // Shrink window on the left
+    // Shrink window on the left to get half-open interval
     while ((left < *n) && (times[left] <= times[i] - *width_before))
       left++;
     
-    // Number of observations is equal to length of window
-    values_new[i] = right - left + 1;
+    // Drop positions that are no longer inside the window, and save minimum in current time window
+    row_new = values_new + (size_t) i * *num_cols;
+    for (k = 0; k < *num_cols; k++) {
+      ptrdiff_t *deque_k = deque + (size_t) k * (mask + 1);
+      while ((head[k] < tail[k]) && (deque_k[head[k] & mask] < left)) {
+        head[k]++;
+        INSTRUMENT_ADD(elements_touched, 1);
+      }
+      if (head[k] < tail[k])    // non-empty window
+        row_new[k] = deque_values[(size_t) k * (mask + 1) + (head[k] & mask)];
+      else                      // empty window
+        row_new[k] = INFINITY;
+    }
   }
+  INSTRUMENT_WINDOW(right + 1, left);
+  free(deque);
+  free(deque_values);
+  free(head);
+  free(tail);
 }
 
 
-// Rolling sum of observation values
-void rolling_sum(const double values[], const double times[], const int *n, double values_new[],
-  const double *width_before, const double *width_after)
+// Rolling standard deviation of observation values for several time series
+void rolling_sd_batch_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_cols)
 {
-  // values       ... array of time series values
+  // values       ... array of length *n * *num_cols of time series values
   // times        ... array of observation times
-  // n            ... number of observations, i.e. length of 'values' and 'times'
-  // values_new   ... array of length *n to store output time series values
+  // n            ... number of observations, i.e. length of 'times'
+  // values_new   ... array of length *n * *num_cols to store output time series values
   // width_before ... (non-negative) width of rolling window before t_i
   // width_after  ... (non-negative) width of rolling window after t_i
+  // num_cols     ... number of time series
   
-  int left = 0, right = -1;
-  double roll_sum = 0;
+  rolling_var_batch_long(values, times, n, values_new, width_before, width_after, num_cols);
+  for (size_t j = 0; j < (size_t) *n * *num_cols; j++)
+    values_new[j] = sqrt(values_new[j]);
+}
+
+
+// Rolling sum of observation values for several time series
+void rolling_sum_batch_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_cols)
+{
+  // values       ... array of length *n * *num_cols of time series values
+  // times        ... array of observation times
+  // n            ... number of observations, i.e. length of 'times'
+  // values_new   ... array of length *n * *num_cols to store output time series values
+  // width_before ... (non-negative) width of rolling window before t_i
+  // width_after  ... (non-negative) width of rolling window after t_i
+  // num_cols     ... number of time series
+  
+  ptrdiff_t left = 0, right = -1;
+  int k;
+  const double *row;
+  double *row_new;
+  double *roll_sum = INSTRUMENT_CALLOC(*num_cols, sizeof(double));
   
-  for (int i = 0; i < *n; i++) {
+  for (ptrdiff_t i = 0; i < *n; i++) {
     // Expand window on the right
     while ((right < *n - 1) && (times[right + 1] <= times[i] + *width_after)) {
       right++;
-      roll_sum = roll_sum + values[right];
+      row = values + (size_t) right * *num_cols;
+      for (k = 0; k < *num_cols; k++)
+        roll_sum[k] = roll_sum[k] + row[k];
     }
     
     // Shrink window on the left
     while ((left < *n) && (times[left] <= times[i] - *width_before)) {
-      roll_sum = roll_sum - values[left];
+      row = values + (size_t) left * *num_cols;
+      for (k = 0; k < *num_cols; k++)
+        roll_sum[k] = roll_sum[k] - row[k];
       left++;
     }
     
     // Update rolling sum
-    values_new[i] = roll_sum;
+    row_new = values_new + (size_t) i * *num_cols;
+    for (k = 0; k < *num_cols; k++)
+      row_new[k] = roll_sum[k];
   }
+  INSTRUMENT_WINDOW(right + 1, left);
+  free(roll_sum);
 }
 
 
-// Same as rolling_sum, but use Kahan (1965) summation algorithm to reduce numerical error
-void rolling_sum_stable(const double values[], const double times[], const int *n, double values_new[],
-  const double *width_before, const double *width_after)
+// Rolling variance of observation values for several time series
+void rolling_var_batch_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_cols)
 {
-  // values       ... array of time series values
+  // values       ... array of length *n * *num_cols of time series values
   // times        ... array of observation times
-  // n            ... number of observations, i.e. length of 'values' and 'times'
-  // values_new   ... array of length *n to store output time series values
+  // n            ... number of observations, i.e. length of 'times'
+  // values_new   ... array of length *n * *num_cols to store output time series values
   // width_before ... (non-negative) width of rolling window before t_i
   // width_after  ... (non-negative) width of rolling window after t_i
+  // num_cols     ... number of time series
   
-  int left = 0, right = -1;
-  double roll_sum = 0, comp = 0;
+  ptrdiff_t left = 0, right = -1, count = 0;
+  int k;
+  double delta;
+  const double *row;
+  double *row_new;
+  double *mean = INSTRUMENT_CALLOC(*num_cols, sizeof(double));
+  double *m2 = INSTRUMENT_CALLOC(*num_cols, sizeof(double));
+  ptrdiff_t *run_start = INSTRUMENT_CALLOC(*num_cols, sizeof(ptrdiff_t));
   
-  for (int i = 0; i < *n; i++) {
-    // Expand window on the right
+  for (ptrdiff_t i = 0; i < *n; i++) {
+    // Expand window on the right (see welford_add and rolling_var)
     while ((right < *n - 1) && (times[right + 1] <= times[i] + *width_after)) {
       right++;
-      compensated_addition(&roll_sum, values[right], &comp);
+      row = values + (size_t) right * *num_cols;
+      for (k = 0; k < *num_cols; k++) {
+        if ((count == 0) || (row[k] != row[k - *num_cols]))
+          run_start[k] = right;
+        delta = row[k] - mean[k];
+        mean[k] += delta / (count + 1);
+        m2[k] += delta * (row[k] - mean[k]);
+      }
+      count++;
     }
     
-    // Shrink window on the left
+    // Shrink window on the left (see welford_remove)
     while ((left < *n) && (times[left] <= times[i] - *width_before)) {
-      compensated_addition(&roll_sum, -values[left], &comp);
+      count--;
+      row = values + (size_t) left * *num_cols;
+      for (k = 0; k < *num_cols; k++) {
+        if (count == 0) {
+          mean[k] = 0;
+          m2[k] = 0;
+        } else {
+          delta = row[k] - mean[k];
+          mean[k] -= delta / count;
+          m2[k] -= delta * (row[k] - mean[k]);
+        }
+      }
       left++;
     }
     
-    // Update rolling sum
-    values_new[i] = roll_sum;
+    // Calculate sample variance in current time window
+    row_new = values_new + (size_t) i * *num_cols;
+    for (k = 0; k < *num_cols; k++) {
+      // Discard accumulated rounding errors if all observation values in the window are identical
+      if ((count > 0) && (run_start[k] <= left)) {
+        mean[k] = values[(size_t) right * *num_cols + k];
+        m2[k] = 0;
+      }
+      
+      if (count >= 2)
+        row_new[k] = (m2[k] > 0 ? m2[k] : 0) / (count - 1);
+      else
+        row_new[k] = NAN;
+    }
   }
+  INSTRUMENT_WINDOW(right + 1, left);
+  free(mean);
+  free(m2);
+  free(run_start);
 }
 
 
 
-// Rolling product of observation values
-void rolling_product(const double values[], const double times[], const int *n, double values_new[],
-  const double *width_before, const double *width_after)
+/************ Static versions for user-defined time windows ************/
+// -) the k-th time window is the half-open interval (start_times[k], end_times[k]], where both the window start times
+//    and end times are strictly increasing, and start_times[k] <= end_times[k]
+// -) the observations inside each time window are determined by a merged sweep of two pointers through the
+//    observation times, so that the total running time is O(n + num_windows) for all statistics except the median
+// -) observations between non-overlapping time windows are added and removed again right away
+
+
+// Rolling number of observation values in static time windows
+void rolling_static_num_obs_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double start_times[], const double end_times[], const ptrdiff_t *num_windows)
 {
-  // values       ... array of time series values
-  // times        ... array of observation times
-  // n            ... number of observations, i.e. length of 'values' and 'times'
-  // values_new   ... array of length *n to store output time series values
-  // width_before ... (non-negative) width of rolling window before t_i
-  // width_after  ... (non-negative) width of rolling window after t_i
+  // values      ... array of time series values
+  // times       ... array of observation times
+  // n           ... number of observations, i.e. length of 'values' and 'times'
+  // values_new  ... array of length *num_windows to store output values
+  // start_times ... array of window start times (exclusive)
+  // end_times   ... array of window end times (inclusive)
+  // num_windows ... number of time windows, i.e. length of 'start_times' and 'end_times'
   
-  int left = 0, right = -1, most_recent_zero = -1;
-  double roll_product = 1;
+  ptrdiff_t left = 0, right = -1;
   
-  for (int i = 0; i < *n; i++) {
+  for (ptrdiff_t k = 0; k < *num_windows; k++) {
     // Expand window on the right
-    while ((right < *n - 1) && (times[right + 1] <= times[i] + *width_after)) {
+    while ((right < *n - 1) && (times[right + 1] <= end_times[k]))
       right++;
-      roll_product = roll_product * values[right];
-      
-      // Save position of most recent zero
-      if ((values[right] > -1e-10) && (values[right] < 1e-10))
-        most_recent_zero = right;
+    
+    // Shrink window on the left
+    while ((left < *n) && (times[left] <= start_times[k]))
+      left++;
+    
+    // Save number of observations in current time window
+    values_new[k] = (right >= left) ? right - left + 1 : 0;
+  }
+  INSTRUMENT_WINDOW(right + 1, left);
+}
+
+
+// Rolling sum of observation values in static time windows
+void rolling_static_sum_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double start_times[], const double end_times[], const ptrdiff_t *num_windows)
+{
+  // values      ... array of time series values
+  // times       ... array of observation times
+  // n           ... number of observations, i.e. length of 'values' and 'times'
+  // values_new  ... array of length *num_windows to store output values
+  // start_times ... array of window start times (exclusive)
+  // end_times   ... array of window end times (inclusive)
+  // num_windows ... number of time windows, i.e. length of 'start_times' and 'end_times'
+  
+  ptrdiff_t left = 0, right = -1;
+  double roll_sum = 0;
+  
+  for (ptrdiff_t k = 0; k < *num_windows; k++) {
+    // Expand window on the right
+    while ((right < *n - 1) && (times[right + 1] <= end_times[k])) {
+      right++;
+      roll_sum = roll_sum + values[right];
     }
     
     // Shrink window on the left
-    while ((left < *n) && (times[left] <= times[i] - *width_before)) {
-      // Don't need to update rolling product if zero drops out, because calculated from scratch below
-      if ((values[left] < -1e-10) || (values[left] > 1e-10))
-        roll_product = roll_product / values[left];
+    while ((left < *n) && (times[left] <= start_times[k])) {
+      roll_sum = roll_sum - values[left];
       left++;
     }
     
-    // Update rolling product
-    // -) need to calculate from scratch in case a zero dropped out of the window
-    if ((roll_product == 0) && (most_recent_zero < left)) {
-      roll_product = 1;
-      for (int pos=left; pos <= right; pos++)
-        roll_product = roll_product * values[pos];
+    // Discard accumulated rounding errors if the window is empty
+    if (right < left)
+      roll_sum = 0;
+    values_new[k] = roll_sum;
+  }
+  INSTRUMENT_WINDOW(right + 1, left);
+}
+
+
+// Rolling product of observation values in static time windows (see rolling_product)
+void rolling_static_product_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double start_times[], const double end_times[], const ptrdiff_t *num_windows)
+{
+  // values      ... array of time series values
+  // times       ... array of observation times
+  // n           ... number of observations, i.e. length of 'values' and 'times'
+  // values_new  ... array of length *num_windows to store output values
+  // start_times ... array of window start times (exclusive)
+  // end_times   ... array of window end times (inclusive)
+  // num_windows ... number of time windows, i.e. length of 'start_times' and 'end_times'
+  
+  ptrdiff_t left = 0, right = -1, num_zero = 0, num_negative = 0;
+  double log_sum = 0, comp = 0;
+  
+  for (ptrdiff_t k = 0; k < *num_windows; k++) {
+    // Expand window on the right
+    while ((right < *n - 1) && (times[right + 1] <= end_times[k])) {
+      right++;
+      log_product_add(values[right], &num_zero, &num_negative, &log_sum, &comp);
     }
-    values_new[i] = roll_product;
+    
+    // Shrink window on the left
+    while ((left < *n) && (times[left] <= start_times[k])) {
+      log_product_remove(values[left], &num_zero, &num_negative, &log_sum, &comp);
+      left++;
+    }
+    
+    // Discard accumulated rounding errors if no non-zero values remain, e.g. if the window is empty
+    if (right - left + 1 <= num_zero)
+      log_sum = comp = 0;
+    
+    // Update rolling product
+    values_new[k] = log_product_value(values, left, right, num_zero, num_negative, log_sum);
   }
+  INSTRUMENT_WINDOW(right + 1, left);
 }
 
 
-// Rolling average of observation values
-void rolling_mean(const double values[], const double times[], const int *n, double values_new[],
-  const double *width_before, const double *width_after)
+// Rolling average of observation values in static time windows
+void rolling_static_mean_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double start_times[], const double end_times[], const ptrdiff_t *num_windows)
 {
-  // values       ... array of time series values
-  // times        ... array of observation times
-  // n            ... number of observations, i.e. length of 'values' and 'times'
-  // values_new   ... array of length *n to store output time series values
-  // width_before ... (non-negative) width of rolling window before t_i
-  // width_after  ... (non-negative) width of rolling window after t_i
+  // values      ... array of time series values
+  // times       ... array of observation times
+  // n           ... number of observations, i.e. length of 'values' and 'times'
+  // values_new  ... array of length *num_windows to store output values
+  // start_times ... array of window start times (exclusive)
+  // end_times   ... array of window end times (inclusive)
+  // num_windows ... number of time windows, i.e. length of 'start_times' and 'end_times'
   
-  int left = 0, right = -1;
+  ptrdiff_t left = 0, right = -1;
   double roll_sum = 0;
   
-  for (int i = 0; i < *n; i++) {
+  for (ptrdiff_t k = 0; k < *num_windows; k++) {
     // Expand window on the right
-    while ((right < *n - 1) && (times[right + 1] <= times[i] + *width_after)) {
+    while ((right < *n - 1) && (times[right + 1] <= end_times[k])) {
       right++;
       roll_sum = roll_sum + values[right];
     }
     
-    // Shrink window on the left to get half-open interval
-    while ((left < *n) && (times[left] <= times[i] - *width_before)) {
+    // Shrink window on the left
+    while ((left < *n) && (times[left] <= start_times[k])) {
       roll_sum = roll_sum - values[left];
       left++;
     }
     
-    // Calculate mean of values in rolling window
-    if (left <= right)  // non-empty window
-      values_new[i] = roll_sum / (right - left + 1);
-    else                // empty window
-      values_new[i] = NAN;
+    // Calculate mean, or discard accumulated rounding errors if the window is empty
+    if (right >= left)
+      values_new[k] = roll_sum / (right - left + 1);
+    else {
+      roll_sum = 0;
+      values_new[k] = NAN;
+    }
   }
+  INSTRUMENT_WINDOW(right + 1, left);
 }
 
 
-// Rolling maximum of observation values
-void rolling_max(const double values[], const double times[], const int *n, double values_new[],
-  const double *width_before, const double *width_after)
+// Rolling maximum of observation values in static time windows
+// -) use a monotonic deque ("ascending maxima") of candidate positions to get O(1) amortized time per observation
+void rolling_static_max_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double start_times[], const double end_times[], const ptrdiff_t *num_windows)
 {
-  // values       ... array of time series values
-  // times        ... array of observation times matching time series values
-  // n            ... length of 'values'
-  // values_new   ... array (of same length as 'values') used to store output
-  // width_before ... (non-negative) width of rolling window before t_i
-  // width_after  ... (non-negative) width of rolling window after t_i
+  // values      ... array of time series values
+  // times       ... array of observation times
+  // n           ... number of observations, i.e. length of 'values' and 'times'
+  // values_new  ... array of length *num_windows to store output values
+  // start_times ... array of window start times (exclusive)
+  // end_times   ... array of window end times (inclusive)
+  // num_windows ... number of time windows, i.e. length of 'start_times' and 'end_times'
+  
+  ptrdiff_t left = 0, right = -1, head = 0, tail = 0;
   
-  int j, left = 0, right = -1, max_pos = 0;
+  // Positions deque[head], ..., deque[tail - 1] inside the time window with strictly decreasing values, stored in a
+  // buffer that is compacted or enlarged when it is full (see deque_make_room)
+  ptrdiff_t capacity = (*n > 0) && (*n < RING_BUFFER_INITIAL_CAPACITY) ? *n : RING_BUFFER_INITIAL_CAPACITY;
+  ptrdiff_t *deque = INSTRUMENT_MALLOC(capacity * sizeof(ptrdiff_t));
   
-  for (int i = 0; i < *n; i++) {
+  for (ptrdiff_t k = 0; k < *num_windows; k++) {
     // Expand window on the right
-    while ((right < *n - 1) && (times[right + 1] <= times[i] + *width_after)) {
+    // -) positions with values <= the new value can never become the maximum again
+    while ((right < *n - 1) && (times[right + 1] <= end_times[k])) {
       right++;
-      if (values[right] >= values[max_pos])
-        max_pos = right;
+      while ((tail > head) && (values[deque[tail - 1]] <= values[right])) {
+        tail--;
+        INSTRUMENT_ADD(elements_touched, 1);
+      }
+      if (tail == capacity)
+        deque = deque_make_room(deque, &head, &tail, &capacity, 1);
+      deque[tail++] = right;
     }
     
-    // Shrink window on the left to get half-open interval
-    while ((left < *n) && (times[left] <= times[i] - *width_before))
-      left++;      
+    // Shrink window on the left
+    while ((left < *n) && (times[left] <= start_times[k]))
+      left++;
     
-    // Recalculate position of maximum if old maximum dropped out
-    // Inline functionality of max_index() to avoid function call overhead
-    if (max_pos < left) {
-      max_pos = left;
-      for (j = left+1; j <= right; j++)
-        if (values[j] >= values[max_pos])
-          max_pos = j;
+    // Drop positions that are no longer inside the window
+    while ((head < tail) && (deque[head] < left)) {
+      head++;
+      INSTRUMENT_ADD(elements_touched, 1);
     }
     
     // Save maximum in current time window
-    if (left <= right)  // non-empty window
-      values_new[i] = values[max_pos];
+    if (head < tail)    // non-empty window
+      values_new[k] = values[deque[head]];
     else                // empty window
-      values_new[i] = -INFINITY;
+      values_new[k] = -INFINITY;
   }
+  INSTRUMENT_WINDOW(right + 1, left);
+  free(deque);
 }
 
 
-// Rolling minimum of observation values
-void rolling_min(const double values[], const double times[], const int *n, double values_new[],
-  const double *width_before, const double *width_after)
+// Rolling median of observation values in static time windows
+void rolling_static_median_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double start_times[], const double end_times[], const ptrdiff_t *num_windows)
 {
-  // values       ... array of time series values
-  // times        ... array of observation times matching time series values
-  // n            ... length of 'values'
-  // values_new   ... array (of same length as 'values') used to store output
-  // width_before ... (non-negative) width of rolling window before t_i
-  // width_after  ... (non-negative) width of rolling window after t_i
+  // values      ... array of time series values
+  // times       ... array of observation times
+  // n           ... number of observations, i.e. length of 'values' and 'times'
+  // values_new  ... array of length *num_windows to store output values
+  // start_times ... array of window start times (exclusive)
+  // end_times   ... array of window end times (inclusive)
+  // num_windows ... number of time windows, i.e. length of 'start_times' and 'end_times'
   
-  int j, left = 0, right = -1, min_pos = 0;
+  ptrdiff_t left = 0, right = -1;
+  skiplist *window = skiplist_create();   // sorted observation values in time window
   
-  for (int i = 0; i < *n; i++) {   
+  for (ptrdiff_t k = 0; k < *num_windows; k++) {
     // Expand window on the right
-    while ((right < *n - 1) && (times[right + 1] <= times[i] + *width_after)) {
+    while ((right < *n - 1) && (times[right + 1] <= end_times[k])) {
       right++;
-      if (values[right] <= values[min_pos])
-        min_pos = right;
+      skiplist_insert(window, values[right]);
     }
     
-    // Shrink window on the left to get half-open interval
-    while ((left < *n) && (times[left] <= times[i] - *width_before))
-      left++;      
+    // Shrink window on the left
+    while ((left < *n) && (times[left] <= start_times[k])) {
+      skiplist_remove(window, values[left]);
+      left++;
+    }
+    
+    // Calculate the median of the sorted window values
+    values_new[k] = skiplist_median(window);
+  }
+  INSTRUMENT_WINDOW(right + 1, left);
+  skiplist_free(window);
+}
+
+
+// Rolling minimum of observation values in static time windows
+// -) use a monotonic deque ("ascending minima") of candidate positions to get O(1) amortized time per observation
+void rolling_static_min_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double start_times[], const double end_times[], const ptrdiff_t *num_windows)
+{
+  // values      ... array of time series values
+  // times       ... array of observation times
+  // n           ... number of observations, i.e. length of 'values' and 'times'
+  // values_new  ... array of length *num_windows to store output values
+  // start_times ... array of window start times (exclusive)
+  // end_times   ... array of window end times (inclusive)
+  // num_windows ... number of time windows, i.e. length of 'start_times' and 'end_times'
+  
+  ptrdiff_t left = 0, right = -1, head = 0, tail = 0;
+  
+  // Positions deque[head], ..., deque[tail - 1] inside the time window with strictly increasing values, stored in a
+  // buffer that is compacted or enlarged when it is full (see deque_make_room)
+  ptrdiff_t capacity = (*n > 0) && (*n < RING_BUFFER_INITIAL_CAPACITY) ? *n : RING_BUFFER_INITIAL_CAPACITY;
+  ptrdiff_t *deque = INSTRUMENT_MALLOC(capacity * sizeof(ptrdiff_t));
+  
+  for (ptrdiff_t k = 0; k < *num_windows; k++) {
+    // Expand window on the right
+    // -) positions with values >= the new value can never become the minimum again
+    while ((right < *n - 1) && (times[right + 1] <= end_times[k])) {
+      right++;
+      while ((tail > head) && (values[deque[tail - 1]] >= values[right])) {
+        tail--;
+        INSTRUMENT_ADD(elements_touched, 1);
+      }
+      if (tail == capacity)
+        deque = deque_make_room(deque, &head, &tail, &capacity, 1);
+      deque[tail++] = right;
+    }
+    
+    // Shrink window on the left
+    while ((left < *n) && (times[left] <= start_times[k]))
+      left++;
     
-    // Recalculate position of minimum if old minimum dropped out
-    // Inline the calculation of the minimum position to avoid any function call overhead
-    if (min_pos < left) {
-      min_pos = left;
-      for (j = left+1; j <= right; j++)
-        if (values[j] <= values[min_pos])
-          min_pos = j;
+    // Drop positions that are no longer inside the window
+    while ((head < tail) && (deque[head] < left)) {
+      head++;
+      INSTRUMENT_ADD(elements_touched, 1);
     }
     
-    // Save minium in current time window
-    if (left <= right)  // non-empty window
-      values_new[i] = values[min_pos];
+    // Save minimum in current time window
+    if (head < tail)    // non-empty window
+      values_new[k] = values[deque[head]];
     else                // empty window
-      values_new[i] = INFINITY;
+      values_new[k] = INFINITY;
   }
+  INSTRUMENT_WINDOW(right + 1, left);
+  free(deque);
 }
 
 
-// Rolling median
-void rolling_median(const double values[], const double times[], const int *n, double values_new[], 
-  const double *width_before, const double *width_after)
+// Rolling variance of observation values in static time windows
+void rolling_static_var_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double start_times[], const double end_times[], const ptrdiff_t *num_windows)
 {
-  // values       ... array of time series values
-  // times        ... array of observation times matching time series values
-  // n            ... length of 'values'
-  // values_new   ... array (of same length as 'values') used to store output
-  // width_before ... (non-negative) width of rolling window before t_i
-  // width_after  ... (non-negative) width of rolling window after t_i
+  // values      ... array of time series values
+  // times       ... array of observation times
+  // n           ... number of observations, i.e. length of 'values' and 'times'
+  // values_new  ... array of length *num_windows to store output values
+  // start_times ... array of window start times (exclusive)
+  // end_times   ... array of window end times (inclusive)
+  // num_windows ... number of time windows, i.e. length of 'start_times' and 'end_times'
   
-  int j, window_length, left = 0, right = -1;
-  double values_tmp[*n];      // temporary array for median(), which shuffles the input data 
-
-  for (int i = 0; i < *n; i++) {
+  ptrdiff_t left = 0, right = -1, count = 0, run_start = 0;
+  double mean = 0, m2 = 0;
+  
+  for (ptrdiff_t k = 0; k < *num_windows; k++) {
     // Expand window on the right
-    while ((right < *n - 1) && (times[right + 1] <= times[i] + *width_after))
+    while ((right < *n - 1) && (times[right + 1] <= end_times[k])) {
       right++;
+      if ((count == 0) || (values[right] != values[right - 1]))
+        run_start = right;
+      welford_add(values[right], &count, &mean, &m2);
+    }
     
-    // Shrink window on the left end
-    while ((left < *n) && (times[left] <= times[i] - *width_before))
+    // Shrink window on the left
+    while ((left < *n) && (times[left] <= start_times[k])) {
+      welford_remove(values[left], &count, &mean, &m2);
       left++;
+    }
     
-    // Copy data in rolling window to temporary array, then calculate the median
-    window_length = right - left + 1;
-    for (j = 0; j < window_length; j++)
-      values_tmp[j] = values[left + j];
-    values_new[i] = median(values_tmp, window_length);
+    // Discard accumulated rounding errors if all observation values in the window are identical (see rolling_var)
+    if ((count > 0) && (run_start <= left)) {
+      mean = values[right];
+      m2 = 0;
+    }
+    
+    // Calculate sample variance in current time window
+    // -) the sum of squared deviations can become slightly negative due to rounding errors
+    if (count >= 2)
+      values_new[k] = (m2 > 0 ? m2 : 0) / (count - 1);
+    else
+      values_new[k] = NAN;
   }
+  INSTRUMENT_WINDOW(right + 1, left);
 }
 
 
-// Rolling central moment of observation values
-void rolling_central_moment(const double values[], const double times[], const int *n, double values_new[],
-  const double *width_before, const double *width_after, const double *m)
+
+/************ Several rolling statistics in a single pass ************/
+
+// Rolling number of observations, sum, mean, variance, standard deviation, minimum, and/or maximum of observation values
+// -) the rolling window is determined only once, and only the accumulators needed for the requested statistics are
+//    updated. Each output column is identical to the output of the corresponding single-statistic function.
+void rolling_summary_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after, const int stats[], const int *num_stats)
 {
   // values       ... array of time series values
   // times        ... array of observation times
   // n            ... number of observations, i.e. length of 'values' and 'times'
-  // values_new   ... array of length *n to store output time series values
+  // values_new   ... array of length *n * *num_stats to store output values in column-major order, i.e. one column
+  //                  for each requested statistic
   // width_before ... (non-negative) width of rolling window before t_i
   // width_after  ... (non-negative) width of rolling window after t_i
-  // m            ... which moment to calculate (non-negative number)
+  // stats        ... array of requested statistics (see enum rolling_summary_statistic)
+  // num_stats    ... number of requested statistics, i.e. length of 'stats'
   
-  int left = 0, right = -1;
-  double tmp;
+  ptrdiff_t left = 0, right = -1, count = 0, run_start = 0;
+  double roll_sum = 0, mean = 0, m2 = 0;
+  ptrdiff_t max_head = 0, max_tail = 0, min_head = 0, min_tail = 0;
   
-  // Calculate the rolling first moment
-  double *rolling_1st_moment = malloc(*n * sizeof(double));
-  rolling_mean(values, times, n, rolling_1st_moment, width_before, width_after);
+  // Determine which accumulators are needed
+  int need_sum = 0, need_var = 0, need_min = 0, need_max = 0;
+  for (int k = 0; k < *num_stats; k++) {
+    need_sum |= (stats[k] == SUMMARY_SUM) || (stats[k] == SUMMARY_MEAN);
+    need_var |= (stats[k] == SUMMARY_VAR) || (stats[k] == SUMMARY_SD);
+    need_min |= (stats[k] == SUMMARY_MIN);
+    need_max |= (stats[k] == SUMMARY_MAX);
+  }
   
-  // Calculate m-th central moment
-  for (int i = 0; i < *n; i++) {
+  // Monotonic deques of candidate positions (see rolling_max and rolling_min), stored in buffers that are compacted or
+  // enlarged before the positions entering the window are added
+  ptrdiff_t max_capacity = (*n > 0) && (*n < RING_BUFFER_INITIAL_CAPACITY) ? *n : RING_BUFFER_INITIAL_CAPACITY;
+  ptrdiff_t min_capacity = max_capacity;
+  ptrdiff_t *max_deque = need_max ? INSTRUMENT_MALLOC(max_capacity * sizeof(ptrdiff_t)) : NULL;
+  ptrdiff_t *min_deque = need_min ? INSTRUMENT_MALLOC(min_capacity * sizeof(ptrdiff_t)) : NULL;
+  
+  for (ptrdiff_t i = 0; i < *n; i++) {
     // Expand window on the right
-    while ((right < *n - 1) && (times[right + 1] <= times[i] + *width_after))
+    ptrdiff_t right_new = right;
+    while ((right_new < *n - 1) && (times[right_new + 1] <= times[i] + *width_after))
+      right_new++;
+    if (need_max && (max_tail + right_new - right > max_capacity))
+      max_deque = deque_make_room(max_deque, &max_head, &max_tail, &max_capacity, right_new - right);
+    if (need_min && (min_tail + right_new - right > min_capacity))
+      min_deque = deque_make_room(min_deque, &min_head, &min_tail, &min_capacity, right_new - right);
+    while (right < right_new) {
       right++;
+      if (need_sum)
+        roll_sum = roll_sum + values[right];
+      if (need_var) {
+        if ((count == 0) || (values[right] != values[right - 1]))
+          run_start = right;
+        welford_add(values[right], &count, &mean, &m2);
+      }
+      if (need_max) {
+        while ((max_tail > max_head) && (values[max_deque[max_tail - 1]] <= values[right])) {
+          max_tail--;
+          INSTRUMENT_ADD(elements_touched, 1);
+        }
+        max_deque[max_tail++] = right;
+      }
+      if (need_min) {
+        while ((min_tail > min_head) && (values[min_deque[min_tail - 1]] >= values[right])) {
+          min_tail--;
+          INSTRUMENT_ADD(elements_touched, 1);
+        }
+        min_deque[min_tail++] = right;
+      }
+    }
     
     // Shrink window on the left
-    while ((left < *n) && (times[left] <= times[i] - *width_before))
+    while ((left < *n) && (times[left] <= times[i] - *width_before)) {
+      if (need_sum)
+        roll_sum = roll_sum - values[left];
+      if (need_var)
+        welford_remove(values[left], &count, &mean, &m2);
       left++;
+    }
+    
+    // Drop positions that are no longer inside the window
+    while ((max_head < max_tail) && (max_deque[max_head] < left)) {
+      max_head++;
+      INSTRUMENT_ADD(elements_touched, 1);
+    }
+    while ((min_head < min_tail) && (min_deque[min_head] < left)) {
+      min_head++;
+      INSTRUMENT_ADD(elements_touched, 1);
+    }
+    
+    // Discard accumulated rounding errors if all observation values in the window are identical (see rolling_var)
+    if (need_var && (count > 0) && (run_start <= left)) {
+      mean = values[right];
+      m2 = 0;
+    }
     
-    // Calculate m-th central moment in current time window
-    if (left < right) {   // two or more observations in time window
-      tmp = 0;
-      for (int pos = left; pos <= right; pos++)
-        tmp = tmp + pow(values[pos] - rolling_1st_moment[i], *m);
-      values_new[i] = tmp / (right - left);
-    } else
-      values_new[i] = NAN;
+    // Save requested statistics
+    for (int k = 0; k < *num_stats; k++) {
+      double *out = values_new + i + (size_t) k * *n;
+      switch (stats[k]) {
+        case SUMMARY_NUM_OBS:
+          *out = right - left + 1;
+          break;
+        case SUMMARY_SUM:
+          *out = roll_sum;
+          break;
+        case SUMMARY_MEAN:
+          *out = (left <= right) ? roll_sum / (right - left + 1) : NAN;
+          break;
+        case SUMMARY_VAR:
+          *out = (count >= 2) ? (m2 > 0 ? m2 : 0) / (count - 1) : NAN;
+          break;
+        case SUMMARY_SD:
+          *out = sqrt((count >= 2) ? (m2 > 0 ? m2 : 0) / (count - 1) : NAN);
+          break;
+        case SUMMARY_MIN:
+          *out = (min_head < min_tail) ? values[min_deque[min_head]] : INFINITY;
+          break;
+        case SUMMARY_MAX:
+          *out = (max_head < max_tail) ? values[max_deque[max_head]] : -INFINITY;
+          break;
+        default:
+          *out = NAN;
+      }
+    }
   }
-  free(rolling_1st_moment);
+  INSTRUMENT_WINDOW(right + 1, left);
+  free(max_deque);
+  free(min_deque);
 }
 
 
 
-// Rolling standard deviation of observation values
+/************ Versions with 32-bit lengths ************/
+
+void rolling_central_moment(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after, const double *m)
+{
+  ptrdiff_t n_long = *n;
+  rolling_central_moment_long(values, times, &n_long, values_new, width_before, width_after, m);
+}
+
+
+void rolling_kurtosis(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after)
+{
+  ptrdiff_t n_long = *n;
+  rolling_kurtosis_long(values, times, &n_long, values_new, width_before, width_after);
+}
+
+
+void rolling_max(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after)
+{
+  ptrdiff_t n_long = *n;
+  rolling_max_long(values, times, &n_long, values_new, width_before, width_after);
+}
+
+
+void rolling_mean(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after)
+{
+  ptrdiff_t n_long = *n;
+  rolling_mean_long(values, times, &n_long, values_new, width_before, width_after);
+}
+
+
+void rolling_median(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after)
+{
+  ptrdiff_t n_long = *n;
+  rolling_median_long(values, times, &n_long, values_new, width_before, width_after);
+}
+
+
+void rolling_min(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after)
+{
+  ptrdiff_t n_long = *n;
+  rolling_min_long(values, times, &n_long, values_new, width_before, width_after);
+}
+
+
+void rolling_num_obs(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after)
+{
+  ptrdiff_t n_long = *n;
+  rolling_num_obs_long(values, times, &n_long, values_new, width_before, width_after);
+}
+
+
+void rolling_product(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after)
+{
+  ptrdiff_t n_long = *n;
+  rolling_product_long(values, times, &n_long, values_new, width_before, width_after);
+}
+
+
 void rolling_sd(const double values[], const double times[], const int *n, double values_new[],
   const double *width_before, const double *width_after)
 {
-  // values       ... array of time series values
-  // times        ... array of observation times
-  // n            ... number of observations, i.e. length of 'values' and 'times'
-  // values_new   ... array of length *n to store output time series values
-  // width_before ... (non-negative) width of rolling window before t_i
-  // width_after  ... (non-negative) width of rolling window after t_i
-  
-  double moment = 2;
-  rolling_central_moment(values, times, n, values_new, width_before, width_after, &moment);
-  for (int i = 0; i < *n; i++)
-    values_new[i] = sqrt(values_new[i]);
+  ptrdiff_t n_long = *n;
+  rolling_sd_long(values, times, &n_long, values_new, width_before, width_after);
+}
+
+
+void rolling_quantile(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after, const double probs[], const int *num_probs)
+{
+  ptrdiff_t n_long = *n;
+  rolling_quantile_long(values, times, &n_long, values_new, width_before, width_after, probs, num_probs);
+}
+
+
+void rolling_skewness(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after)
+{
+  ptrdiff_t n_long = *n;
+  rolling_skewness_long(values, times, &n_long, values_new, width_before, width_after);
+}
+
+
+void rolling_sum(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after)
+{
+  ptrdiff_t n_long = *n;
+  rolling_sum_long(values, times, &n_long, values_new, width_before, width_after);
+}
+
+
+void rolling_sum_stable(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after)
+{
+  ptrdiff_t n_long = *n;
+  rolling_sum_stable_long(values, times, &n_long, values_new, width_before, width_after);
 }
 
 
-// Rolling variance of observation values
 void rolling_var(const double values[], const double times[], const int *n, double values_new[],
   const double *width_before, const double *width_after)
 {
-  // values       ... array of time series values
-  // times        ... array of observation times
-  // n            ... number of observations, i.e. length of 'values' and 'times'
-  // values_new   ... array of length *n to store output time series values
-  // width_before ... (non-negative) width of rolling window before t_i
-  // width_after  ... (non-negative) width of rolling window after t_i
-  
-  double moment = 2;
-  rolling_central_moment(values, times, n, values_new, width_before, width_after, &moment);
+  ptrdiff_t n_long = *n;
+  rolling_var_long(values, times, &n_long, values_new, width_before, width_after);
+}
+
+
+void rolling_max_batch(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_cols)
+{
+  ptrdiff_t n_long = *n;
+  rolling_max_batch_long(values, times, &n_long, values_new, width_before, width_after, num_cols);
+}
+
+
+void rolling_mean_batch(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_cols)
+{
+  ptrdiff_t n_long = *n;
+  rolling_mean_batch_long(values, times, &n_long, values_new, width_before, width_after, num_cols);
+}
+
+
+void rolling_min_batch(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_cols)
+{
+  ptrdiff_t n_long = *n;
+  rolling_min_batch_long(values, times, &n_long, values_new, width_before, width_after, num_cols);
+}
+
+
+void rolling_sd_batch(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_cols)
+{
+  ptrdiff_t n_long = *n;
+  rolling_sd_batch_long(values, times, &n_long, values_new, width_before, width_after, num_cols);
+}
+
+
+void rolling_sum_batch(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_cols)
+{
+  ptrdiff_t n_long = *n;
+  rolling_sum_batch_long(values, times, &n_long, values_new, width_before, width_after, num_cols);
+}
+
+
+void rolling_var_batch(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_cols)
+{
+  ptrdiff_t n_long = *n;
+  rolling_var_batch_long(values, times, &n_long, values_new, width_before, width_after, num_cols);
+}
+
+
+void rolling_max_parallel(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_threads, const int *min_chunk)
+{
+  ptrdiff_t n_long = *n;
+  rolling_max_parallel_long(values, times, &n_long, values_new, width_before, width_after, num_threads, min_chunk);
+}
+
+
+void rolling_mean_parallel(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_threads, const int *min_chunk)
+{
+  ptrdiff_t n_long = *n;
+  rolling_mean_parallel_long(values, times, &n_long, values_new, width_before, width_after, num_threads, min_chunk);
+}
+
+
+void rolling_min_parallel(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_threads, const int *min_chunk)
+{
+  ptrdiff_t n_long = *n;
+  rolling_min_parallel_long(values, times, &n_long, values_new, width_before, width_after, num_threads, min_chunk);
+}
+
+
+void rolling_num_obs_parallel(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_threads, const int *min_chunk)
+{
+  ptrdiff_t n_long = *n;
+  rolling_num_obs_parallel_long(values, times, &n_long, values_new, width_before, width_after, num_threads, min_chunk);
+}
+
+
+void rolling_sum_parallel(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_threads, const int *min_chunk)
+{
+  ptrdiff_t n_long = *n;
+  rolling_sum_parallel_long(values, times, &n_long, values_new, width_before, width_after, num_threads, min_chunk);
+}
+
+
+void rolling_static_max(const double values[], const double times[], const int *n, double values_new[],
+  const double start_times[], const double end_times[], const int *num_windows)
+{
+  ptrdiff_t n_long = *n;
+  ptrdiff_t num_windows_long = *num_windows;
+  rolling_static_max_long(values, times, &n_long, values_new, start_times, end_times, &num_windows_long);
+}
+
+
+void rolling_static_mean(const double values[], const double times[], const int *n, double values_new[],
+  const double start_times[], const double end_times[], const int *num_windows)
+{
+  ptrdiff_t n_long = *n;
+  ptrdiff_t num_windows_long = *num_windows;
+  rolling_static_mean_long(values, times, &n_long, values_new, start_times, end_times, &num_windows_long);
+}
+
+
+void rolling_static_median(const double values[], const double times[], const int *n, double values_new[],
+  const double start_times[], const double end_times[], const int *num_windows)
+{
+  ptrdiff_t n_long = *n;
+  ptrdiff_t num_windows_long = *num_windows;
+  rolling_static_median_long(values, times, &n_long, values_new, start_times, end_times, &num_windows_long);
+}
+
+
+void rolling_static_min(const double values[], const double times[], const int *n, double values_new[],
+  const double start_times[], const double end_times[], const int *num_windows)
+{
+  ptrdiff_t n_long = *n;
+  ptrdiff_t num_windows_long = *num_windows;
+  rolling_static_min_long(values, times, &n_long, values_new, start_times, end_times, &num_windows_long);
+}
+
+
+void rolling_static_num_obs(const double values[], const double times[], const int *n, double values_new[],
+  const double start_times[], const double end_times[], const int *num_windows)
+{
+  ptrdiff_t n_long = *n;
+  ptrdiff_t num_windows_long = *num_windows;
+  rolling_static_num_obs_long(values, times, &n_long, values_new, start_times, end_times, &num_windows_long);
+}
+
+
+void rolling_static_product(const double values[], const double times[], const int *n, double values_new[],
+  const double start_times[], const double end_times[], const int *num_windows)
+{
+  ptrdiff_t n_long = *n;
+  ptrdiff_t num_windows_long = *num_windows;
+  rolling_static_product_long(values, times, &n_long, values_new, start_times, end_times, &num_windows_long);
+}
+
+
+void rolling_static_sum(const double values[], const double times[], const int *n, double values_new[],
+  const double start_times[], const double end_times[], const int *num_windows)
+{
+  ptrdiff_t n_long = *n;
+  ptrdiff_t num_windows_long = *num_windows;
+  rolling_static_sum_long(values, times, &n_long, values_new, start_times, end_times, &num_windows_long);
+}
+
+
+void rolling_static_var(const double values[], const double times[], const int *n, double values_new[],
+  const double start_times[], const double end_times[], const int *num_windows)
+{
+  ptrdiff_t n_long = *n;
+  ptrdiff_t num_windows_long = *num_windows;
+  rolling_static_var_long(values, times, &n_long, values_new, start_times, end_times, &num_windows_long);
+}
+
+
+void rolling_summary(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after, const int stats[], const int *num_stats)
+{
+  ptrdiff_t n_long = *n;
+  rolling_summary_long(values, times, &n_long, values_new, width_before, width_after, stats, num_stats);
 }
@@ -1,13 +1,164 @@
 // Copyright: 2012-2018 by Andreas Eckner
 // License: GPL-2 | GPL-3
-// Remark: To facilitate interfaces to other programming languages such as R, all variables are either pointers or arrays
+// Remark: To facilitate interfaces to other programming languages such as R, all variables are either pointers or arrays.
+//         The number of observations has type ptrdiff_t to support long vectors (more than 2^31 - 1 elements) in R,
+//         and the functions without suffix "_long" are thin wrappers for callers with 32-bit lengths.
+//         The observation times need to be strictly increasing. The rolling operators with a single output value per
+//         output position are implemented in rolling_core.cpp, and rely on this for causal and anticausal windows.
 
 #ifndef _rolling_h
 #define _rolling_h
 
+#include <stddef.h>
+
+void rolling_central_moment_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after, const double *m);
+
+void rolling_kurtosis_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after);
+
+void rolling_log_product_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after);
+
+void rolling_max_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after);
+
+void rolling_mean_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after);
+
+void rolling_median_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after);
+
+void rolling_min_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after);
+
+void rolling_num_obs_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after);
+
+void rolling_product_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after);
+
+void rolling_sd_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after);
+
+void rolling_quantile_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after, const double probs[], const int *num_probs);
+
+void rolling_skewness_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after);
+
+void rolling_sum_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after);
+
+void rolling_sum_exact_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after);
+
+void rolling_sum_neumaier_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after);
+
+void rolling_sum_stable_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after);
+
+void rolling_var_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after);
+
+// Batch versions for several time series with identical observation times, stored in row-major order
+void rolling_max_batch_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_cols);
+
+void rolling_mean_batch_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_cols);
+
+void rolling_min_batch_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_cols);
+
+void rolling_sd_batch_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_cols);
+
+void rolling_sum_batch_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_cols);
+
+void rolling_var_batch_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_cols);
+
+// Multi-threaded versions, where the output positions are split into chunks of at least *min_chunk positions
+void rolling_max_parallel_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_threads, const int *min_chunk);
+
+void rolling_mean_parallel_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_threads, const int *min_chunk);
+
+void rolling_min_parallel_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_threads, const int *min_chunk);
+
+void rolling_num_obs_parallel_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_threads, const int *min_chunk);
+
+void rolling_sum_parallel_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_threads, const int *min_chunk);
+
+// Static versions for user-defined time windows (start_times[k], end_times[k]]
+void rolling_static_max_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double start_times[], const double end_times[], const ptrdiff_t *num_windows);
+
+void rolling_static_mean_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double start_times[], const double end_times[], const ptrdiff_t *num_windows);
+
+void rolling_static_median_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double start_times[], const double end_times[], const ptrdiff_t *num_windows);
+
+void rolling_static_min_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double start_times[], const double end_times[], const ptrdiff_t *num_windows);
+
+void rolling_static_num_obs_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double start_times[], const double end_times[], const ptrdiff_t *num_windows);
+
+void rolling_static_product_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double start_times[], const double end_times[], const ptrdiff_t *num_windows);
+
+void rolling_static_sum_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double start_times[], const double end_times[], const ptrdiff_t *num_windows);
+
+void rolling_static_var_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double start_times[], const double end_times[], const ptrdiff_t *num_windows);
+
+// Several rolling statistics in a single pass, with one output column per requested statistic
+enum rolling_summary_statistic {SUMMARY_NUM_OBS = 0, SUMMARY_SUM = 1, SUMMARY_MEAN = 2, SUMMARY_VAR = 3, SUMMARY_SD = 4,
+  SUMMARY_MIN = 5, SUMMARY_MAX = 6};
+
+void rolling_summary_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after, const int stats[], const int *num_stats);
+
+// Single-precision versions with float observation values and output values, but double observation times
+// -) the rolling number of observations is exact up to 2^24 observations per window
+void rolling_max_float_long(const float values[], const double times[], const ptrdiff_t *n, float values_new[],
+  const double *width_before, const double *width_after);
+
+void rolling_mean_float_long(const float values[], const double times[], const ptrdiff_t *n, float values_new[],
+  const double *width_before, const double *width_after);
+
+void rolling_min_float_long(const float values[], const double times[], const ptrdiff_t *n, float values_new[],
+  const double *width_before, const double *width_after);
+
+void rolling_num_obs_float_long(const float values[], const double times[], const ptrdiff_t *n, float values_new[],
+  const double *width_before, const double *width_after);
+
+void rolling_sd_float_long(const float values[], const double times[], const ptrdiff_t *n, float values_new[],
+  const double *width_before, const double *width_after);
+
+void rolling_sum_float_long(const float values[], const double times[], const ptrdiff_t *n, float values_new[],
+  const double *width_before, const double *width_after);
+
+void rolling_var_float_long(const float values[], const double times[], const ptrdiff_t *n, float values_new[],
+  const double *width_before, const double *width_after);
+
+// Versions with 32-bit lengths
 void rolling_central_moment(const double values[], const double times[], const int *n, double values_new[],
   const double *width_before, const double *width_after, const double *m);
 
+void rolling_kurtosis(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after);
+
 void rolling_max(const double values[], const double times[], const int *n, double values_new[],
   const double *width_before, const double *width_after);
 
@@ -29,6 +180,12 @@ void rolling_product(const double values[], const double times[], const int *n,
 void rolling_sd(const double values[], const double times[], const int *n, double values_new[],
   const double *width_before, const double *width_after);
 
+void rolling_quantile(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after, const double probs[], const int *num_probs);
+
+void rolling_skewness(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after);
+
 void rolling_sum(const double values[], const double times[], const int *n, double values_new[],
   const double *width_before, const double *width_after);
 
@@ -38,4 +195,64 @@ void rolling_sum_stable(const double values[], const double times[], const int *
 void rolling_var(const double values[], const double times[], const int *n, double values_new[],
   const double *width_before, const double *width_after);
 
+void rolling_max_batch(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_cols);
+
+void rolling_mean_batch(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_cols);
+
+void rolling_min_batch(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_cols);
+
+void rolling_sd_batch(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_cols);
+
+void rolling_sum_batch(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_cols);
+
+void rolling_var_batch(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_cols);
+
+void rolling_max_parallel(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_threads, const int *min_chunk);
+
+void rolling_mean_parallel(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_threads, const int *min_chunk);
+
+void rolling_min_parallel(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_threads, const int *min_chunk);
+
+void rolling_num_obs_parallel(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_threads, const int *min_chunk);
+
+void rolling_sum_parallel(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_threads, const int *min_chunk);
+
+void rolling_static_max(const double values[], const double times[], const int *n, double values_new[],
+  const double start_times[], const double end_times[], const int *num_windows);
+
+void rolling_static_mean(const double values[], const double times[], const int *n, double values_new[],
+  const double start_times[], const double end_times[], const int *num_windows);
+
+void rolling_static_median(const double values[], const double times[], const int *n, double values_new[],
+  const double start_times[], const double end_times[], const int *num_windows);
+
+void rolling_static_min(const double values[], const double times[], const int *n, double values_new[],
+  const double start_times[], const double end_times[], const int *num_windows);
+
+void rolling_static_num_obs(const double values[], const double times[], const int *n, double values_new[],
+  const double start_times[], const double end_times[], const int *num_windows);
+
+void rolling_static_product(const double values[], const double times[], const int *n, double values_new[],
+  const double start_times[], const double end_times[], const int *num_windows);
+
+void rolling_static_sum(const double values[], const double times[], const int *n, double values_new[],
+  const double start_times[], const double end_times[], const int *num_windows);
+
+void rolling_static_var(const double values[], const double times[], const int *n, double values_new[],
+  const double start_times[], const double end_times[], const int *num_windows);
+
+void rolling_summary(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after, const int stats[], const int *num_stats);
+
 #endif
@@ -10,11 +10,39 @@ Rcpp::NumericVector Rcpp_wrapper_rolling_central_moment(Rcpp::NumericVector& val
   double width_before, double width_after, double m)
 {
   // Allocate memory for output
-  int n = values.size();
+  ptrdiff_t n = values.size();
   Rcpp::NumericVector res(n);
   
   // Call C function
-  rolling_central_moment(values.begin(), times.begin(), &n, res.begin(), &width_before, &width_after, &m);
+  rolling_central_moment_long(values.begin(), times.begin(), &n, res.begin(), &width_before, &width_after, &m);
+  return res;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::NumericVector Rcpp_wrapper_rolling_kurtosis(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times,
+  double width_before, double width_after)
+{
+  // Allocate memory for output
+  ptrdiff_t n = values.size();
+  Rcpp::NumericVector res(n);
+  
+  // Call C function
+  rolling_kurtosis_long(values.begin(), times.begin(), &n, res.begin(), &width_before, &width_after);
+  return res;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::NumericVector Rcpp_wrapper_rolling_log_product(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times,
+  double width_before, double width_after)
+{
+  // Allocate memory for output
+  ptrdiff_t n = values.size();
+  Rcpp::NumericVector res(n);
+  
+  // Call C function
+  rolling_log_product_long(values.begin(), times.begin(), &n, res.begin(), &width_before, &width_after);
   return res;
 }
 
@@ -24,11 +52,11 @@ Rcpp::NumericVector Rcpp_wrapper_rolling_max(Rcpp::NumericVector& values, Rcpp::
   double width_before, double width_after)
 {
   // Allocate memory for output
-  int n = values.size();
+  ptrdiff_t n = values.size();
   Rcpp::NumericVector res(n);
   
   // Call C function
-  rolling_max(values.begin(), times.begin(), &n, res.begin(), &width_before, &width_after);
+  rolling_max_long(values.begin(), times.begin(), &n, res.begin(), &width_before, &width_after);
   return res;
 }
 
@@ -38,11 +66,11 @@ Rcpp::NumericVector Rcpp_wrapper_rolling_mean(Rcpp::NumericVector& values, Rcpp:
   double width_before, double width_after)
 {
   // Allocate memory for output
-  int n = values.size();
+  ptrdiff_t n = values.size();
   Rcpp::NumericVector res(n);
   
   // Call C function
-  rolling_mean(values.begin(), times.begin(), &n, res.begin(), &width_before, &width_after);
+  rolling_mean_long(values.begin(), times.begin(), &n, res.begin(), &width_before, &width_after);
   return res;
 }
 
@@ -52,11 +80,11 @@ Rcpp::NumericVector Rcpp_wrapper_rolling_median(Rcpp::NumericVector& values, Rcp
   double width_before, double width_after)
 {
   // Allocate memory for output
-  int n = values.size();
+  ptrdiff_t n = values.size();
   Rcpp::NumericVector res(n);
   
   // Call C function
-  rolling_median(values.begin(), times.begin(), &n, res.begin(), &width_before, &width_after);
+  rolling_median_long(values.begin(), times.begin(), &n, res.begin(), &width_before, &width_after);
   return res;
 }
 
@@ -66,11 +94,11 @@ Rcpp::NumericVector Rcpp_wrapper_rolling_min(Rcpp::NumericVector& values, Rcpp::
   double width_before, double width_after)
 {
   // Allocate memory for output
-  int n = values.size();
+  ptrdiff_t n = values.size();
   Rcpp::NumericVector res(n);
   
   // Call C function
-  rolling_min(values.begin(), times.begin(), &n, res.begin(), &width_before, &width_after);
+  rolling_min_long(values.begin(), times.begin(), &n, res.begin(), &width_before, &width_after);
   return res;
 }
 
@@ -80,11 +108,11 @@ Rcpp::NumericVector Rcpp_wrapper_rolling_num_obs(Rcpp::NumericVector& values, Rc
   double width_before, double width_after)
 {
   // Allocate memory for output
-  int n = values.size();
+  ptrdiff_t n = values.size();
   Rcpp::NumericVector res(n);
   
   // Call C function
-  rolling_num_obs(values.begin(), times.begin(), &n, res.begin(), &width_before, &width_after);
+  rolling_num_obs_long(values.begin(), times.begin(), &n, res.begin(), &width_before, &width_after);
   return res;
 }
 
@@ -94,11 +122,27 @@ Rcpp::NumericVector Rcpp_wrapper_rolling_product(Rcpp::NumericVector& values, Rc
   double width_before, double width_after)
 {
   // Allocate memory for output
-  int n = values.size();
+  ptrdiff_t n = values.size();
   Rcpp::NumericVector res(n);
   
   // Call C function
-  rolling_product(values.begin(), times.begin(), &n, res.begin(), &width_before, &width_after);
+  rolling_product_long(values.begin(), times.begin(), &n, res.begin(), &width_before, &width_after);
+  return res;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::NumericMatrix Rcpp_wrapper_rolling_quantile(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times,
+  double width_before, double width_after, Rcpp::NumericVector& probs)
+{
+  // Allocate memory for output
+  ptrdiff_t n = values.size();
+  int num_probs = probs.size();
+  Rcpp::NumericMatrix res(n, num_probs);
+  
+  // Call C function
+  rolling_quantile_long(values.begin(), times.begin(), &n, res.begin(), &width_before, &width_after, probs.begin(),
+    &num_probs);
   return res;
 }
 
@@ -108,11 +152,25 @@ Rcpp::NumericVector Rcpp_wrapper_rolling_sd(Rcpp::NumericVector& values, Rcpp::D
   double width_before, double width_after)
 {
   // Allocate memory for output
-  int n = values.size();
+  ptrdiff_t n = values.size();
+  Rcpp::NumericVector res(n);
+  
+  // Call C function
+  rolling_sd_long(values.begin(), times.begin(), &n, res.begin(), &width_before, &width_after);
+  return res;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::NumericVector Rcpp_wrapper_rolling_skewness(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times,
+  double width_before, double width_after)
+{
+  // Allocate memory for output
+  ptrdiff_t n = values.size();
   Rcpp::NumericVector res(n);
   
   // Call C function
-  rolling_sd(values.begin(), times.begin(), &n, res.begin(), &width_before, &width_after);
+  rolling_skewness_long(values.begin(), times.begin(), &n, res.begin(), &width_before, &width_after);
   return res;
 }
 
@@ -122,11 +180,39 @@ Rcpp::NumericVector Rcpp_wrapper_rolling_sum(Rcpp::NumericVector& values, Rcpp::
   double width_before, double width_after)
 {
   // Allocate memory for output
-  int n = values.size();
+  ptrdiff_t n = values.size();
+  Rcpp::NumericVector res(n);
+  
+  // Call C function
+  rolling_sum_long(values.begin(), times.begin(), &n, res.begin(), &width_before, &width_after);
+  return res;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::NumericVector Rcpp_wrapper_rolling_sum_exact(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times,
+  double width_before, double width_after)
+{
+  // Allocate memory for output
+  ptrdiff_t n = values.size();
+  Rcpp::NumericVector res(n);
+  
+  // Call C function
+  rolling_sum_exact_long(values.begin(), times.begin(), &n, res.begin(), &width_before, &width_after);
+  return res;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::NumericVector Rcpp_wrapper_rolling_sum_neumaier(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times,
+  double width_before, double width_after)
+{
+  // Allocate memory for output
+  ptrdiff_t n = values.size();
   Rcpp::NumericVector res(n);
   
   // Call C function
-  rolling_sum(values.begin(), times.begin(), &n, res.begin(), &width_before, &width_after);
+  rolling_sum_neumaier_long(values.begin(), times.begin(), &n, res.begin(), &width_before, &width_after);
   return res;
 }
 
@@ -136,11 +222,11 @@ Rcpp::NumericVector Rcpp_wrapper_rolling_sum_stable(Rcpp::NumericVector& values,
   double width_before, double width_after)
 {
   // Allocate memory for output
-  int n = values.size();
+  ptrdiff_t n = values.size();
   Rcpp::NumericVector res(n);
   
   // Call C function
-  rolling_sum_stable(values.begin(), times.begin(), &n, res.begin(), &width_before, &width_after);
+  rolling_sum_stable_long(values.begin(), times.begin(), &n, res.begin(), &width_before, &width_after);
   return res;
 }
 
@@ -150,10 +236,347 @@ Rcpp::NumericVector Rcpp_wrapper_rolling_var(Rcpp::NumericVector& values, Rcpp::
   double width_before, double width_after)
 {
   // Allocate memory for output
-  int n = values.size();
+  ptrdiff_t n = values.size();
   Rcpp::NumericVector res(n);
   
   // Call C function
-  rolling_var(values.begin(), times.begin(), &n, res.begin(), &width_before, &width_after);
+  rolling_var_long(values.begin(), times.begin(), &n, res.begin(), &width_before, &width_after);
+  return res;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::NumericMatrix Rcpp_wrapper_rolling_max_batch(Rcpp::NumericMatrix& values, Rcpp::DatetimeVector& times,
+  double width_before, double width_after)
+{
+  // Allocate memory for output
+  ptrdiff_t n = values.ncol();
+  int num_cols = values.nrow();
+  Rcpp::NumericMatrix res(num_cols, n);
+  if (times.size() != n)
+    Rcpp::stop("The number of columns of 'values' and the length of 'times' need to match");
+  
+  // Call C function
+  rolling_max_batch_long(values.begin(), times.begin(), &n, res.begin(), &width_before, &width_after, &num_cols);
+  return res;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::NumericMatrix Rcpp_wrapper_rolling_mean_batch(Rcpp::NumericMatrix& values, Rcpp::DatetimeVector& times,
+  double width_before, double width_after)
+{
+  // Allocate memory for output
+  ptrdiff_t n = values.ncol();
+  int num_cols = values.nrow();
+  Rcpp::NumericMatrix res(num_cols, n);
+  if (times.size() != n)
+    Rcpp::stop("The number of columns of 'values' and the length of 'times' need to match");
+  
+  // Call C function
+  rolling_mean_batch_long(values.begin(), times.begin(), &n, res.begin(), &width_before, &width_after, &num_cols);
+  return res;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::NumericMatrix Rcpp_wrapper_rolling_min_batch(Rcpp::NumericMatrix& values, Rcpp::DatetimeVector& times,
+  double width_before, double width_after)
+{
+  // Allocate memory for output
+  ptrdiff_t n = values.ncol();
+  int num_cols = values.nrow();
+  Rcpp::NumericMatrix res(num_cols, n);
+  if (times.size() != n)
+    Rcpp::stop("The number of columns of 'values' and the length of 'times' need to match");
+  
+  // Call C function
+  rolling_min_batch_long(values.begin(), times.begin(), &n, res.begin(), &width_before, &width_after, &num_cols);
+  return res;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::NumericMatrix Rcpp_wrapper_rolling_sd_batch(Rcpp::NumericMatrix& values, Rcpp::DatetimeVector& times,
+  double width_before, double width_after)
+{
+  // Allocate memory for output
+  ptrdiff_t n = values.ncol();
+  int num_cols = values.nrow();
+  Rcpp::NumericMatrix res(num_cols, n);
+  if (times.size() != n)
+    Rcpp::stop("The number of columns of 'values' and the length of 'times' need to match");
+  
+  // Call C function
+  rolling_sd_batch_long(values.begin(), times.begin(), &n, res.begin(), &width_before, &width_after, &num_cols);
+  return res;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::NumericMatrix Rcpp_wrapper_rolling_sum_batch(Rcpp::NumericMatrix& values, Rcpp::DatetimeVector& times,
+  double width_before, double width_after)
+{
+  // Allocate memory for output
+  ptrdiff_t n = values.ncol();
+  int num_cols = values.nrow();
+  Rcpp::NumericMatrix res(num_cols, n);
+  if (times.size() != n)
+    Rcpp::stop("The number of columns of 'values' and the length of 'times' need to match");
+  
+  // Call C function
+  rolling_sum_batch_long(values.begin(), times.begin(), &n, res.begin(), &width_before, &width_after, &num_cols);
+  return res;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::NumericMatrix Rcpp_wrapper_rolling_var_batch(Rcpp::NumericMatrix& values, Rcpp::DatetimeVector& times,
+  double width_before, double width_after)
+{
+  // Allocate memory for output
+  ptrdiff_t n = values.ncol();
+  int num_cols = values.nrow();
+  Rcpp::NumericMatrix res(num_cols, n);
+  if (times.size() != n)
+    Rcpp::stop("The number of columns of 'values' and the length of 'times' need to match");
+  
+  // Call C function
+  rolling_var_batch_long(values.begin(), times.begin(), &n, res.begin(), &width_before, &width_after, &num_cols);
+  return res;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::NumericVector Rcpp_wrapper_rolling_max_parallel(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times,
+  double width_before, double width_after, int num_threads, int min_chunk)
+{
+  // Allocate memory for output
+  ptrdiff_t n = values.size();
+  Rcpp::NumericVector res(n);
+  
+  // Call C function
+  rolling_max_parallel_long(values.begin(), times.begin(), &n, res.begin(), &width_before, &width_after, &num_threads,
+    &min_chunk);
+  return res;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::NumericVector Rcpp_wrapper_rolling_mean_parallel(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times,
+  double width_before, double width_after, int num_threads, int min_chunk)
+{
+  // Allocate memory for output
+  ptrdiff_t n = values.size();
+  Rcpp::NumericVector res(n);
+  
+  // Call C function
+  rolling_mean_parallel_long(values.begin(), times.begin(), &n, res.begin(), &width_before, &width_after,
+    &num_threads, &min_chunk);
+  return res;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::NumericVector Rcpp_wrapper_rolling_min_parallel(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times,
+  double width_before, double width_after, int num_threads, int min_chunk)
+{
+  // Allocate memory for output
+  ptrdiff_t n = values.size();
+  Rcpp::NumericVector res(n);
+  
+  // Call C function
+  rolling_min_parallel_long(values.begin(), times.begin(), &n, res.begin(), &width_before, &width_after, &num_threads,
+    &min_chunk);
+  return res;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::NumericVector Rcpp_wrapper_rolling_num_obs_parallel(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times,
+  double width_before, double width_after, int num_threads, int min_chunk)
+{
+  // Allocate memory for output
+  ptrdiff_t n = values.size();
+  Rcpp::NumericVector res(n);
+  
+  // Call C function
+  rolling_num_obs_parallel_long(values.begin(), times.begin(), &n, res.begin(), &width_before, &width_after,
+    &num_threads, &min_chunk);
+  return res;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::NumericVector Rcpp_wrapper_rolling_sum_parallel(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times,
+  double width_before, double width_after, int num_threads, int min_chunk)
+{
+  // Allocate memory for output
+  ptrdiff_t n = values.size();
+  Rcpp::NumericVector res(n);
+  
+  // Call C function
+  rolling_sum_parallel_long(values.begin(), times.begin(), &n, res.begin(), &width_before, &width_after, &num_threads,
+    &min_chunk);
+  return res;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::NumericVector Rcpp_wrapper_rolling_static_max(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times,
+  Rcpp::DatetimeVector& start_times, Rcpp::DatetimeVector& end_times)
+{
+  // Allocate memory for output
+  ptrdiff_t n = values.size();
+  ptrdiff_t num_windows = start_times.size();
+  Rcpp::NumericVector res(num_windows);
+  if (end_times.size() != num_windows)
+    Rcpp::stop("The number of window start and end times differs");
+  
+  // Call C function
+  rolling_static_max_long(values.begin(), times.begin(), &n, res.begin(), start_times.begin(),
+    end_times.begin(), &num_windows);
+  return res;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::NumericVector Rcpp_wrapper_rolling_static_mean(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times,
+  Rcpp::DatetimeVector& start_times, Rcpp::DatetimeVector& end_times)
+{
+  // Allocate memory for output
+  ptrdiff_t n = values.size();
+  ptrdiff_t num_windows = start_times.size();
+  Rcpp::NumericVector res(num_windows);
+  if (end_times.size() != num_windows)
+    Rcpp::stop("The number of window start and end times differs");
+  
+  // Call C function
+  rolling_static_mean_long(values.begin(), times.begin(), &n, res.begin(), start_times.begin(),
+    end_times.begin(), &num_windows);
+  return res;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::NumericVector Rcpp_wrapper_rolling_static_median(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times,
+  Rcpp::DatetimeVector& start_times, Rcpp::DatetimeVector& end_times)
+{
+  // Allocate memory for output
+  ptrdiff_t n = values.size();
+  ptrdiff_t num_windows = start_times.size();
+  Rcpp::NumericVector res(num_windows);
+  if (end_times.size() != num_windows)
+    Rcpp::stop("The number of window start and end times differs");
+  
+  // Call C function
+  rolling_static_median_long(values.begin(), times.begin(), &n, res.begin(), start_times.begin(),
+    end_times.begin(), &num_windows);
+  return res;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::NumericVector Rcpp_wrapper_rolling_static_min(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times,
+  Rcpp::DatetimeVector& start_times, Rcpp::DatetimeVector& end_times)
+{
+  // Allocate memory for output
+  ptrdiff_t n = values.size();
+  ptrdiff_t num_windows = start_times.size();
+  Rcpp::NumericVector res(num_windows);
+  if (end_times.size() != num_windows)
+    Rcpp::stop("The number of window start and end times differs");
+  
+  // Call C function
+  rolling_static_min_long(values.begin(), times.begin(), &n, res.begin(), start_times.begin(),
+    end_times.begin(), &num_windows);
+  return res;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::NumericVector Rcpp_wrapper_rolling_static_num_obs(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times,
+  Rcpp::DatetimeVector& start_times, Rcpp::DatetimeVector& end_times)
+{
+  // Allocate memory for output
+  ptrdiff_t n = values.size();
+  ptrdiff_t num_windows = start_times.size();
+  Rcpp::NumericVector res(num_windows);
+  if (end_times.size() != num_windows)
+    Rcpp::stop("The number of window start and end times differs");
+  
+  // Call C function
+  rolling_static_num_obs_long(values.begin(), times.begin(), &n, res.begin(), start_times.begin(),
+    end_times.begin(), &num_windows);
+  return res;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::NumericVector Rcpp_wrapper_rolling_static_product(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times,
+  Rcpp::DatetimeVector& start_times, Rcpp::DatetimeVector& end_times)
+{
+  // Allocate memory for output
+  ptrdiff_t n = values.size();
+  ptrdiff_t num_windows = start_times.size();
+  Rcpp::NumericVector res(num_windows);
+  if (end_times.size() != num_windows)
+    Rcpp::stop("The number of window start and end times differs");
+  
+  // Call C function
+  rolling_static_product_long(values.begin(), times.begin(), &n, res.begin(), start_times.begin(),
+    end_times.begin(), &num_windows);
+  return res;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::NumericVector Rcpp_wrapper_rolling_static_sum(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times,
+  Rcpp::DatetimeVector& start_times, Rcpp::DatetimeVector& end_times)
+{
+  // Allocate memory for output
+  ptrdiff_t n = values.size();
+  ptrdiff_t num_windows = start_times.size();
+  Rcpp::NumericVector res(num_windows);
+  if (end_times.size() != num_windows)
+    Rcpp::stop("The number of window start and end times differs");
+  
+  // Call C function
+  rolling_static_sum_long(values.begin(), times.begin(), &n, res.begin(), start_times.begin(),
+    end_times.begin(), &num_windows);
+  return res;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::NumericVector Rcpp_wrapper_rolling_static_var(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times,
+  Rcpp::DatetimeVector& start_times, Rcpp::DatetimeVector& end_times)
+{
+  // Allocate memory for output
+  ptrdiff_t n = values.size();
+  ptrdiff_t num_windows = start_times.size();
+  Rcpp::NumericVector res(num_windows);
+  if (end_times.size() != num_windows)
+    Rcpp::stop("The number of window start and end times differs");
+  
+  // Call C function
+  rolling_static_var_long(values.begin(), times.begin(), &n, res.begin(), start_times.begin(),
+    end_times.begin(), &num_windows);
+  return res;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::NumericMatrix Rcpp_wrapper_rolling_summary(Rcpp::NumericVector& values, Rcpp::DatetimeVector& times,
+  double width_before, double width_after, Rcpp::IntegerVector& stats)
+{
+  // Allocate memory for output
+  ptrdiff_t n = values.size();
+  int num_stats = stats.size();
+  Rcpp::NumericMatrix res(n, num_stats);
+  
+  // Call C function
+  rolling_summary_long(values.begin(), times.begin(), &n, res.begin(), &width_before, &width_after, stats.begin(),
+    &num_stats);
   return res;
 }
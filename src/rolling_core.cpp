@@ -0,0 +1,590 @@
+// Copyright: 2012-2018 by Andreas Eckner
+// License: GPL-2 | GPL-3
+// Remark: C entry points of the rolling operators that are instantiated from the template in rolling_core.h. Each
+//         entry point dispatches to the causal, anticausal, or centered instantiation for its window widths.
+
+#include "rolling_core.h"
+
+extern "C" {
+#include "rolling.h"
+}
+
+
+extern "C" {
+
+// Rolling number of observation values
+void rolling_num_obs_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after)
+{
+  // values       ... array of time series values
+  // times        ... array of observation times
+  // n            ... number of observations, i.e. length of 'values' and 'times'
+  // values_new   ... array of length *n to store output time series values
+  // width_before ... (non-negative) width of rolling window before t_i
+  // width_after  ... (non-negative) width of rolling window after t_i
+
+  NumObsAggregator agg;
+  rolling_dispatch(agg, values, times, *n, values_new, *width_before, *width_after, 0, *n);
+}
+
+
+// Rolling sum of observation values
+void rolling_sum_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after)
+{
+  // values       ... array of time series values
+  // times        ... array of observation times
+  // n            ... number of observations, i.e. length of 'values' and 'times'
+  // values_new   ... array of length *n to store output time series values
+  // width_before ... (non-negative) width of rolling window before t_i
+  // width_after  ... (non-negative) width of rolling window after t_i
+
+  SumAggregator agg;
+  rolling_dispatch(agg, values, times, *n, values_new, *width_before, *width_after, 0, *n);
+}
+
+
+// Same as rolling_sum, but use Kahan (1965) summation algorithm to reduce numerical error
+void rolling_sum_stable_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after)
+{
+  // values       ... array of time series values
+  // times        ... array of observation times
+  // n            ... number of observations, i.e. length of 'values' and 'times'
+  // values_new   ... array of length *n to store output time series values
+  // width_before ... (non-negative) width of rolling window before t_i
+  // width_after  ... (non-negative) width of rolling window after t_i
+
+  SumStableAggregator agg;
+  rolling_dispatch(agg, values, times, *n, values_new, *width_before, *width_after, 0, *n);
+}
+
+
+// Same as rolling_sum, but use Neumaier (1974) summation algorithm to reduce numerical error
+// -) unlike rolling_sum_stable, also compensates the rounding error when a value that is large relative to the rolling
+//    sum leaves the window
+void rolling_sum_neumaier_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after)
+{
+  // values       ... array of time series values
+  // times        ... array of observation times
+  // n            ... number of observations, i.e. length of 'values' and 'times'
+  // values_new   ... array of length *n to store output time series values
+  // width_before ... (non-negative) width of rolling window before t_i
+  // width_after  ... (non-negative) width of rolling window after t_i
+
+  SumNeumaierAggregator agg;
+  rolling_dispatch(agg, values, times, *n, values_new, *width_before, *width_after, 0, *n);
+}
+
+
+// Same as rolling_sum, but exact, i.e. the output is the exact sum of the observation values in the rolling window,
+// rounded to the nearest double
+// -) use a superaccumulator (see superaccumulator.h), so that there is no accumulated rounding error at all
+// -) about 4-5 times slower than rolling_sum (e.g. 55 vs. 13 ns per observation with gcc-12.2 -O2 for 1e6 observations
+//    and ~100 observations per window, see 'bench/utsbench --kernels rolling_sum'), independent of the window width
+void rolling_sum_exact_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after)
+{
+  // values       ... array of time series values
+  // times        ... array of observation times
+  // n            ... number of observations, i.e. length of 'values' and 'times'
+  // values_new   ... array of length *n to store output time series values
+  // width_before ... (non-negative) width of rolling window before t_i
+  // width_after  ... (non-negative) width of rolling window after t_i
+
+  SumExactAggregator agg;
+  rolling_dispatch(agg, values, times, *n, values_new, *width_before, *width_after, 0, *n);
+}
+
+
+// Rolling product of observation values
+// -) takes O(1) time per observation without ever recalculating the product from scratch, and avoids the overflow and
+//    underflow of intermediate products in long windows (see ProductAggregator)
+void rolling_product_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after)
+{
+  // values       ... array of time series values
+  // times        ... array of observation times
+  // n            ... number of observations, i.e. length of 'values' and 'times'
+  // values_new   ... array of length *n to store output time series values
+  // width_before ... (non-negative) width of rolling window before t_i
+  // width_after  ... (non-negative) width of rolling window after t_i
+
+  ProductAggregator<false> agg;
+  rolling_dispatch(agg, values, times, *n, values_new, *width_before, *width_after, 0, *n);
+}
+
+
+// Rolling logarithm of the product of observation values, e.g. for compounding returns over long time horizons
+// -) same as log(rolling_product), i.e. -Inf if there is a zero in the window, and NaN if the product is negative, but
+//    without the overflow and underflow of the product itself
+void rolling_log_product_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after)
+{
+  // values       ... array of time series values
+  // times        ... array of observation times
+  // n            ... number of observations, i.e. length of 'values' and 'times'
+  // values_new   ... array of length *n to store output time series values
+  // width_before ... (non-negative) width of rolling window before t_i
+  // width_after  ... (non-negative) width of rolling window after t_i
+
+  ProductAggregator<true> agg;
+  rolling_dispatch(agg, values, times, *n, values_new, *width_before, *width_after, 0, *n);
+}
+
+
+// Rolling average of observation values
+void rolling_mean_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after)
+{
+  // values       ... array of time series values
+  // times        ... array of observation times
+  // n            ... number of observations, i.e. length of 'values' and 'times'
+  // values_new   ... array of length *n to store output time series values
+  // width_before ... (non-negative) width of rolling window before t_i
+  // width_after  ... (non-negative) width of rolling window after t_i
+
+  MeanAggregator agg;
+  rolling_dispatch(agg, values, times, *n, values_new, *width_before, *width_after, 0, *n);
+}
+
+
+// Rolling maximum of observation values
+void rolling_max_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after)
+{
+  // values       ... array of time series values
+  // times        ... array of observation times
+  // n            ... number of observations, i.e. length of 'values' and 'times'
+  // values_new   ... array of length *n to store output time series values
+  // width_before ... (non-negative) width of rolling window before t_i
+  // width_after  ... (non-negative) width of rolling window after t_i
+
+  MaxAggregator agg;
+  rolling_dispatch(agg, values, times, *n, values_new, *width_before, *width_after, 0, *n);
+}
+
+
+// Rolling minimum of observation values
+void rolling_min_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after)
+{
+  // values       ... array of time series values
+  // times        ... array of observation times
+  // n            ... number of observations, i.e. length of 'values' and 'times'
+  // values_new   ... array of length *n to store output time series values
+  // width_before ... (non-negative) width of rolling window before t_i
+  // width_after  ... (non-negative) width of rolling window after t_i
+
+  MinAggregator agg;
+  rolling_dispatch(agg, values, times, *n, values_new, *width_before, *width_after, 0, *n);
+}
+
+
+// Rolling median
+void rolling_median_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after)
+{
+  // values       ... array of time series values
+  // times        ... array of observation times
+  // n            ... number of observations, i.e. length of 'values' and 'times'
+  // values_new   ... array of length *n to store output time series values
+  // width_before ... (non-negative) width of rolling window before t_i
+  // width_after  ... (non-negative) width of rolling window after t_i
+
+  MedianAggregator agg;
+  rolling_dispatch(agg, values, times, *n, values_new, *width_before, *width_after, 0, *n);
+}
+
+
+// Rolling central moment of observation values
+void rolling_central_moment_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after, const double *m)
+{
+  // values       ... array of time series values
+  // times        ... array of observation times
+  // n            ... number of observations, i.e. length of 'values' and 'times'
+  // values_new   ... array of length *n to store output time series values
+  // width_before ... (non-negative) width of rolling window before t_i
+  // width_after  ... (non-negative) width of rolling window after t_i
+  // m            ... which moment to calculate (non-negative number)
+
+  // Use rolling power sums for the 3rd and 4th moment
+  if (*m == 3) {
+    PowerSumAggregator<CENTRAL_MOMENT_3> agg;
+    rolling_dispatch(agg, values, times, *n, values_new, *width_before, *width_after, 0, *n);
+    return;
+  } else if (*m == 4) {
+    PowerSumAggregator<CENTRAL_MOMENT_4> agg;
+    rolling_dispatch(agg, values, times, *n, values_new, *width_before, *width_after, 0, *n);
+    return;
+  }
+
+  CentralMomentAggregator agg(*m);
+  rolling_dispatch(agg, values, times, *n, values_new, *width_before, *width_after, 0, *n);
+}
+
+
+// Rolling kurtosis of observation values, i.e. the 4th standardized moment (not the excess kurtosis)
+void rolling_kurtosis_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after)
+{
+  // values       ... array of time series values
+  // times        ... array of observation times
+  // n            ... number of observations, i.e. length of 'values' and 'times'
+  // values_new   ... array of length *n to store output time series values
+  // width_before ... (non-negative) width of rolling window before t_i
+  // width_after  ... (non-negative) width of rolling window after t_i
+
+  PowerSumAggregator<KURTOSIS> agg;
+  rolling_dispatch(agg, values, times, *n, values_new, *width_before, *width_after, 0, *n);
+}
+
+
+// Rolling skewness of observation values, i.e. the 3rd standardized moment
+void rolling_skewness_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after)
+{
+  // values       ... array of time series values
+  // times        ... array of observation times
+  // n            ... number of observations, i.e. length of 'values' and 'times'
+  // values_new   ... array of length *n to store output time series values
+  // width_before ... (non-negative) width of rolling window before t_i
+  // width_after  ... (non-negative) width of rolling window after t_i
+
+  PowerSumAggregator<SKEWNESS> agg;
+  rolling_dispatch(agg, values, times, *n, values_new, *width_before, *width_after, 0, *n);
+}
+
+
+// Rolling standard deviation of observation values
+void rolling_sd_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after)
+{
+  // values       ... array of time series values
+  // times        ... array of observation times
+  // n            ... number of observations, i.e. length of 'values' and 'times'
+  // values_new   ... array of length *n to store output time series values
+  // width_before ... (non-negative) width of rolling window before t_i
+  // width_after  ... (non-negative) width of rolling window after t_i
+
+  VarAggregator<true> agg;
+  rolling_dispatch(agg, values, times, *n, values_new, *width_before, *width_after, 0, *n);
+}
+
+
+// Rolling variance of observation values
+// -) single pass, updating the mean and sum of squared deviations as observations enter and leave the window
+void rolling_var_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after)
+{
+  // values       ... array of time series values
+  // times        ... array of observation times
+  // n            ... number of observations, i.e. length of 'values' and 'times'
+  // values_new   ... array of length *n to store output time series values
+  // width_before ... (non-negative) width of rolling window before t_i
+  // width_after  ... (non-negative) width of rolling window after t_i
+
+  VarAggregator<false> agg;
+  rolling_dispatch(agg, values, times, *n, values_new, *width_before, *width_after, 0, *n);
+}
+
+
+
+/****************** Multi-threaded versions ******************/
+// -) each thread applies its own aggregator to a chunk of output positions (see apply_range_kernel)
+
+
+// Rolling number of observation values for output positions start, ..., end - 1
+static void rolling_num_obs_range(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after, ptrdiff_t start, ptrdiff_t end)
+{
+  // values       ... array of time series values
+  // times        ... array of observation times
+  // n            ... number of observations, i.e. length of 'values' and 'times'
+  // values_new   ... array of length *n to store output time series values
+  // width_before ... (non-negative) width of rolling window before t_i
+  // width_after  ... (non-negative) width of rolling window after t_i
+  // start        ... first output position
+  // end          ... one past the last output position
+
+  NumObsAggregator agg;
+  rolling_dispatch(agg, values, times, *n, values_new, *width_before, *width_after, start, end);
+}
+
+
+// Rolling number of observation values using several threads
+void rolling_num_obs_parallel_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_threads, const int *min_chunk)
+{
+  // values       ... array of time series values
+  // times        ... array of observation times
+  // n            ... number of observations, i.e. length of 'values' and 'times'
+  // values_new   ... array of length *n to store output time series values
+  // width_before ... (non-negative) width of rolling window before t_i
+  // width_after  ... (non-negative) width of rolling window after t_i
+  // num_threads  ... maximum number of threads to use
+  // min_chunk    ... minimum number of output positions per thread
+
+  apply_range_kernel(rolling_num_obs_range, values, times, n, values_new, width_before, width_after, num_threads, min_chunk);
+}
+
+
+// Rolling sum of observation values for output positions start, ..., end - 1
+static void rolling_sum_range(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after, ptrdiff_t start, ptrdiff_t end)
+{
+  // values       ... array of time series values
+  // times        ... array of observation times
+  // n            ... number of observations, i.e. length of 'values' and 'times'
+  // values_new   ... array of length *n to store output time series values
+  // width_before ... (non-negative) width of rolling window before t_i
+  // width_after  ... (non-negative) width of rolling window after t_i
+  // start        ... first output position
+  // end          ... one past the last output position
+
+  SumAggregator agg;
+  rolling_dispatch(agg, values, times, *n, values_new, *width_before, *width_after, start, end);
+}
+
+
+// Rolling sum of observation values using several threads
+void rolling_sum_parallel_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_threads, const int *min_chunk)
+{
+  // values       ... array of time series values
+  // times        ... array of observation times
+  // n            ... number of observations, i.e. length of 'values' and 'times'
+  // values_new   ... array of length *n to store output time series values
+  // width_before ... (non-negative) width of rolling window before t_i
+  // width_after  ... (non-negative) width of rolling window after t_i
+  // num_threads  ... maximum number of threads to use
+  // min_chunk    ... minimum number of output positions per thread
+
+  apply_range_kernel(rolling_sum_range, values, times, n, values_new, width_before, width_after, num_threads, min_chunk);
+}
+
+
+// Rolling average of observation values for output positions start, ..., end - 1
+static void rolling_mean_range(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after, ptrdiff_t start, ptrdiff_t end)
+{
+  // values       ... array of time series values
+  // times        ... array of observation times
+  // n            ... number of observations, i.e. length of 'values' and 'times'
+  // values_new   ... array of length *n to store output time series values
+  // width_before ... (non-negative) width of rolling window before t_i
+  // width_after  ... (non-negative) width of rolling window after t_i
+  // start        ... first output position
+  // end          ... one past the last output position
+
+  MeanAggregator agg;
+  rolling_dispatch(agg, values, times, *n, values_new, *width_before, *width_after, start, end);
+}
+
+
+// Rolling average of observation values using several threads
+void rolling_mean_parallel_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_threads, const int *min_chunk)
+{
+  // values       ... array of time series values
+  // times        ... array of observation times
+  // n            ... number of observations, i.e. length of 'values' and 'times'
+  // values_new   ... array of length *n to store output time series values
+  // width_before ... (non-negative) width of rolling window before t_i
+  // width_after  ... (non-negative) width of rolling window after t_i
+  // num_threads  ... maximum number of threads to use
+  // min_chunk    ... minimum number of output positions per thread
+
+  apply_range_kernel(rolling_mean_range, values, times, n, values_new, width_before, width_after, num_threads, min_chunk);
+}
+
+
+// Rolling maximum of observation values for output positions start, ..., end - 1
+static void rolling_max_range(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after, ptrdiff_t start, ptrdiff_t end)
+{
+  // values       ... array of time series values
+  // times        ... array of observation times
+  // n            ... number of observations, i.e. length of 'values' and 'times'
+  // values_new   ... array of length *n to store output time series values
+  // width_before ... (non-negative) width of rolling window before t_i
+  // width_after  ... (non-negative) width of rolling window after t_i
+  // start        ... first output position
+  // end          ... one past the last output position
+
+  MaxAggregator agg;
+  rolling_dispatch(agg, values, times, *n, values_new, *width_before, *width_after, start, end);
+}
+
+
+// Rolling maximum of observation values using several threads
+void rolling_max_parallel_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_threads, const int *min_chunk)
+{
+  // values       ... array of time series values
+  // times        ... array of observation times
+  // n            ... number of observations, i.e. length of 'values' and 'times'
+  // values_new   ... array of length *n to store output time series values
+  // width_before ... (non-negative) width of rolling window before t_i
+  // width_after  ... (non-negative) width of rolling window after t_i
+  // num_threads  ... maximum number of threads to use
+  // min_chunk    ... minimum number of output positions per thread
+
+  apply_range_kernel(rolling_max_range, values, times, n, values_new, width_before, width_after, num_threads, min_chunk);
+}
+
+
+// Rolling minimum of observation values for output positions start, ..., end - 1
+static void rolling_min_range(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after, ptrdiff_t start, ptrdiff_t end)
+{
+  // values       ... array of time series values
+  // times        ... array of observation times
+  // n            ... number of observations, i.e. length of 'values' and 'times'
+  // values_new   ... array of length *n to store output time series values
+  // width_before ... (non-negative) width of rolling window before t_i
+  // width_after  ... (non-negative) width of rolling window after t_i
+  // start        ... first output position
+  // end          ... one past the last output position
+
+  MinAggregator agg;
+  rolling_dispatch(agg, values, times, *n, values_new, *width_before, *width_after, start, end);
+}
+
+
+// Rolling minimum of observation values using several threads
+void rolling_min_parallel_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_threads, const int *min_chunk)
+{
+  // values       ... array of time series values
+  // times        ... array of observation times
+  // n            ... number of observations, i.e. length of 'values' and 'times'
+  // values_new   ... array of length *n to store output time series values
+  // width_before ... (non-negative) width of rolling window before t_i
+  // width_after  ... (non-negative) width of rolling window after t_i
+  // num_threads  ... maximum number of threads to use
+  // min_chunk    ... minimum number of output positions per thread
+
+  apply_range_kernel(rolling_min_range, values, times, n, values_new, width_before, width_after, num_threads, min_chunk);
+}
+
+
+
+/*************** Single-precision versions ****************/
+// -) float observation values and output values, but double observation times and intermediate quantities
+
+
+// Rolling number of observation values
+void rolling_num_obs_float_long(const float values[], const double times[], const ptrdiff_t *n, float values_new[],
+  const double *width_before, const double *width_after)
+{
+  // values       ... array of time series values
+  // times        ... array of observation times
+  // n            ... number of observations, i.e. length of 'values' and 'times'
+  // values_new   ... array of length *n to store output time series values
+  // width_before ... (non-negative) width of rolling window before t_i
+  // width_after  ... (non-negative) width of rolling window after t_i
+
+  NumObsAggregator agg;
+  rolling_dispatch(agg, values, times, *n, values_new, *width_before, *width_after, 0, *n);
+}
+
+
+// Rolling sum of observation values
+void rolling_sum_float_long(const float values[], const double times[], const ptrdiff_t *n, float values_new[],
+  const double *width_before, const double *width_after)
+{
+  // values       ... array of time series values
+  // times        ... array of observation times
+  // n            ... number of observations, i.e. length of 'values' and 'times'
+  // values_new   ... array of length *n to store output time series values
+  // width_before ... (non-negative) width of rolling window before t_i
+  // width_after  ... (non-negative) width of rolling window after t_i
+
+  SumAggregator agg;
+  rolling_dispatch(agg, values, times, *n, values_new, *width_before, *width_after, 0, *n);
+}
+
+
+// Rolling average of observation values
+void rolling_mean_float_long(const float values[], const double times[], const ptrdiff_t *n, float values_new[],
+  const double *width_before, const double *width_after)
+{
+  // values       ... array of time series values
+  // times        ... array of observation times
+  // n            ... number of observations, i.e. length of 'values' and 'times'
+  // values_new   ... array of length *n to store output time series values
+  // width_before ... (non-negative) width of rolling window before t_i
+  // width_after  ... (non-negative) width of rolling window after t_i
+
+  MeanAggregator agg;
+  rolling_dispatch(agg, values, times, *n, values_new, *width_before, *width_after, 0, *n);
+}
+
+
+// Rolling maximum of observation values
+void rolling_max_float_long(const float values[], const double times[], const ptrdiff_t *n, float values_new[],
+  const double *width_before, const double *width_after)
+{
+  // values       ... array of time series values
+  // times        ... array of observation times
+  // n            ... number of observations, i.e. length of 'values' and 'times'
+  // values_new   ... array of length *n to store output time series values
+  // width_before ... (non-negative) width of rolling window before t_i
+  // width_after  ... (non-negative) width of rolling window after t_i
+
+  MaxAggregator agg;
+  rolling_dispatch(agg, values, times, *n, values_new, *width_before, *width_after, 0, *n);
+}
+
+
+// Rolling minimum of observation values
+void rolling_min_float_long(const float values[], const double times[], const ptrdiff_t *n, float values_new[],
+  const double *width_before, const double *width_after)
+{
+  // values       ... array of time series values
+  // times        ... array of observation times
+  // n            ... number of observations, i.e. length of 'values' and 'times'
+  // values_new   ... array of length *n to store output time series values
+  // width_before ... (non-negative) width of rolling window before t_i
+  // width_after  ... (non-negative) width of rolling window after t_i
+
+  MinAggregator agg;
+  rolling_dispatch(agg, values, times, *n, values_new, *width_before, *width_after, 0, *n);
+}
+
+
+// Rolling standard deviation of observation values
+void rolling_sd_float_long(const float values[], const double times[], const ptrdiff_t *n, float values_new[],
+  const double *width_before, const double *width_after)
+{
+  // values       ... array of time series values
+  // times        ... array of observation times
+  // n            ... number of observations, i.e. length of 'values' and 'times'
+  // values_new   ... array of length *n to store output time series values
+  // width_before ... (non-negative) width of rolling window before t_i
+  // width_after  ... (non-negative) width of rolling window after t_i
+
+  VarAggregator<true> agg;
+  rolling_dispatch(agg, values, times, *n, values_new, *width_before, *width_after, 0, *n);
+}
+
+
+// Rolling variance of observation values
+void rolling_var_float_long(const float values[], const double times[], const ptrdiff_t *n, float values_new[],
+  const double *width_before, const double *width_after)
+{
+  // values       ... array of time series values
+  // times        ... array of observation times
+  // n            ... number of observations, i.e. length of 'values' and 'times'
+  // values_new   ... array of length *n to store output time series values
+  // width_before ... (non-negative) width of rolling window before t_i
+  // width_after  ... (non-negative) width of rolling window after t_i
+
+  VarAggregator<false> agg;
+  rolling_dispatch(agg, values, times, *n, values_new, *width_before, *width_after, 0, *n);
+}
+
+}
@@ -0,0 +1,590 @@
+// Copyright: 2012-2018 by Andreas Eckner
+// License: GPL-2 | GPL-3
+// Remark: Rolling window kernels as a C++ template, parameterized by the shape of the rolling time window and by an
+//         aggregator, which maintains the state of a rolling statistic as observations enter and leave the window.
+//         The rolling window for output position i is the half-open time interval
+//         (t_i - width_before, t_i + width_after], and the observation times need to be strictly increasing.
+//         -) causal window (width_after = 0): the current observation is the last one in the window, so the window is
+//            expanded by exactly one observation per output position without comparing observation times
+//         -) anticausal window (width_before = 0): the current observation is the one leaving the window, so the
+//            window is shrunk by exactly one observation per output position without comparing observation times
+//         -) centered window (both widths positive): both ends of the window are found by comparing observation times
+
+#ifndef _rolling_core_h
+#define _rolling_core_h
+
+#include <cfloat>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+
+extern "C" {
+#include "instrument.h"
+#include "parallel.h"
+#include "rolling_helpers.h"
+#include "skiplist.h"
+#include "superaccumulator.h"
+}
+
+
+// Force inlining of aggregator methods that are too large for the default inlining heuristics, because the aggregator
+// state can only be kept in registers if all methods are inlined into the kernel
+#ifdef __GNUC__
+#define AGGREGATOR_INLINE inline __attribute__((always_inline))
+#else
+#define AGGREGATOR_INLINE inline
+#endif
+
+
+// Shape of the rolling time window, depending on which window widths are zero
+enum WindowShape {CAUSAL, ANTICAUSAL, CENTERED};
+
+
+// Local aggregator of rolling_window with an empty window, which is a copy of the prototype, so that the compiler can
+// keep its state in registers
+// -) specialized for aggregators that own memory, which cannot be copied and are constructed from scratch instead
+template <typename Aggregator>
+struct LocalAggregator
+{
+  explicit LocalAggregator(const Aggregator& prototype) : agg(prototype) {}
+  Aggregator agg;
+};
+
+
+// Apply an aggregator to the rolling windows of output positions start, ..., end - 1
+template <WindowShape shape, typename T, typename Aggregator>
+void rolling_window(const Aggregator& prototype, const T values[], const double times[], ptrdiff_t n, T values_new[],
+  double width_before, double width_after, ptrdiff_t start, ptrdiff_t end)
+{
+  // prototype    ... aggregator for the rolling statistic with an empty window (see below)
+  // values       ... array of time series values
+  // times        ... array of observation times
+  // n            ... number of observations, i.e. length of 'values' and 'times'
+  // values_new   ... array of length n to store output time series values
+  // width_before ... (non-negative) width of rolling window before t_i
+  // width_after  ... (non-negative) width of rolling window after t_i
+  // start        ... first output position
+  // end          ... one past the last output position
+
+  // Trivial case
+  if (start >= end)
+    return;
+
+  // Local copy of the aggregator (see LocalAggregator)
+  LocalAggregator<Aggregator> local(prototype);
+  Aggregator& agg = local.agg;
+
+  // Start with an empty window just before the rolling window of the first output position
+  // -) determined by binary search for start > 0 (see apply_range_kernel)
+  // -) for a causal window with width_before = 0, the current observation has to enter the window before leaving it
+  ptrdiff_t left = 0, right = -1;
+  if (start > 0) {
+    left = (shape == ANTICAUSAL) ? start : first_index_after(times, n, times[start] - width_before);
+    if (left > start)
+      left = start;
+    right = left - 1;
+  }
+  agg.reserve(first_index_after(times, n, times[end - 1] + width_after) - left);
+
+  // Only count the window steps for output positions start, ..., end - 1
+  INSTRUMENT_WINDOW(-left, -left);
+
+  // For a causal window, add the observations before the first output position
+  if (shape == CAUSAL) {
+    while (right < start - 1) {
+      right++;
+      agg.add(values, right);
+    }
+  }
+
+  for (ptrdiff_t i = start; i < end; i++) {
+    // Expand window on the right
+    if (shape == CAUSAL) {
+      right = i;
+      agg.add(values, right);
+    } else {
+      while ((right < n - 1) && (times[right + 1] <= times[i] + width_after)) {
+        right++;
+        agg.add(values, right);
+      }
+    }
+
+    // Shrink window on the left
+    if (shape == ANTICAUSAL) {
+      agg.remove(values, left);
+      left++;
+    } else {
+      while ((left < n) && (times[left] <= times[i] - width_before)) {
+        agg.remove(values, left);
+        left++;
+      }
+    }
+
+    // Rolling statistic for observations left, ..., right
+    values_new[i] = agg.value(values, left, right);
+  }
+  INSTRUMENT_WINDOW(right + 1, left);
+}
+
+
+// Apply an aggregator to the rolling windows of output positions start, ..., end - 1, using the template instantiation
+// for the shape of the rolling window
+template <typename T, typename Aggregator>
+void rolling_dispatch(const Aggregator& agg, const T values[], const double times[], ptrdiff_t n, T values_new[],
+  double width_before, double width_after, ptrdiff_t start, ptrdiff_t end)
+{
+  // agg          ... aggregator for the rolling statistic
+  // values       ... array of time series values
+  // times        ... array of observation times
+  // n            ... number of observations, i.e. length of 'values' and 'times'
+  // values_new   ... array of length n to store output time series values
+  // width_before ... (non-negative) width of rolling window before t_i
+  // width_after  ... (non-negative) width of rolling window after t_i
+  // start        ... first output position
+  // end          ... one past the last output position
+
+  if (width_after == 0)
+    rolling_window<CAUSAL>(agg, values, times, n, values_new, width_before, width_after, start, end);
+  else if (width_before == 0)
+    rolling_window<ANTICAUSAL>(agg, values, times, n, values_new, width_before, width_after, start, end);
+  else
+    rolling_window<CENTERED>(agg, values, times, n, values_new, width_before, width_after, start, end);
+}
+
+
+
+/*********************** Aggregators **********************/
+// -) add(values, pos) and remove(values, pos) update the state when observation 'pos' enters or leaves the rolling
+//    window, where observations leave the window in the same order in which they entered it
+// -) value(values, left, right) returns the rolling statistic for observations left, ..., right (i.e. for an empty
+//    window if left > right)
+// -) reserve(size) is called once before the first observation enters the window, with an upper bound for the number
+//    of observations in the window at any time. Aggregators are copied before reserve() is called, so any memory
+//    needs to be allocated in reserve() and not in the constructor. Aggregators that own memory cannot be copied and
+//    need a specialization of LocalAggregator instead.
+// -) all intermediate quantities are kept in double precision, also for float observation values
+
+
+// Base class for aggregators that do not need to allocate memory
+class Aggregator
+{
+public:
+  void reserve(ptrdiff_t) {}
+};
+
+
+// Number of observations
+class NumObsAggregator : public Aggregator
+{
+public:
+  template <typename T> void add(const T[], ptrdiff_t) {}
+  template <typename T> void remove(const T[], ptrdiff_t) {}
+  template <typename T> double value(const T[], ptrdiff_t left, ptrdiff_t right) { return right - left + 1; }
+};
+
+
+// Sum of observation values
+class SumAggregator : public Aggregator
+{
+public:
+  SumAggregator() : roll_sum(0) {}
+
+  template <typename T> void add(const T values[], ptrdiff_t pos) { roll_sum = roll_sum + values[pos]; }
+  template <typename T> void remove(const T values[], ptrdiff_t pos) { roll_sum = roll_sum - values[pos]; }
+  template <typename T> double value(const T[], ptrdiff_t, ptrdiff_t) { return roll_sum; }
+
+protected:
+  double roll_sum;
+};
+
+
+// Sum of observation values using Kahan (1965) summation algorithm to reduce numerical error
+class SumStableAggregator : public Aggregator
+{
+public:
+  SumStableAggregator() : roll_sum(0), comp(0) {}
+
+  void add(const double values[], ptrdiff_t pos) { compensated_addition(&roll_sum, values[pos], &comp); }
+  void remove(const double values[], ptrdiff_t pos) { compensated_addition(&roll_sum, -values[pos], &comp); }
+  double value(const double[], ptrdiff_t, ptrdiff_t) { return roll_sum; }
+
+private:
+  double roll_sum, comp;
+};
+
+
+// Sum of observation values using Neumaier (1974) summation algorithm to reduce numerical error
+class SumNeumaierAggregator : public Aggregator
+{
+public:
+  SumNeumaierAggregator() : roll_sum(0), comp(0) {}
+
+  void add(const double values[], ptrdiff_t pos) { neumaier_addition(&roll_sum, values[pos], &comp); }
+  void remove(const double values[], ptrdiff_t pos) { neumaier_addition(&roll_sum, -values[pos], &comp); }
+  double value(const double[], ptrdiff_t left, ptrdiff_t right)
+  {
+    // Discard accumulated rounding errors if the window is empty
+    if (right < left)
+      roll_sum = comp = 0;
+    return roll_sum + comp;
+  }
+
+private:
+  double roll_sum, comp;
+};
+
+
+// Exact sum of observation values, rounded to the nearest double (see superaccumulator.h)
+class SumExactAggregator : public Aggregator
+{
+public:
+  SumExactAggregator() { superacc_init(&roll_sum); }
+
+  void add(const double values[], ptrdiff_t pos) { superacc_add(&roll_sum, values[pos], 1); }
+  void remove(const double values[], ptrdiff_t pos) { superacc_add(&roll_sum, values[pos], -1); }
+  double value(const double[], ptrdiff_t, ptrdiff_t) { return superacc_value(&roll_sum); }
+
+private:
+  superaccumulator roll_sum;
+};
+
+
+// Average of observation values
+class MeanAggregator : public SumAggregator
+{
+public:
+  template <typename T> double value(const T[], ptrdiff_t left, ptrdiff_t right)
+  {
+    if (left <= right)  // non-empty window
+      return roll_sum / (right - left + 1);
+    else                // empty window
+      return NAN;
+  }
+};
+
+
+// Maximum (maximum=true) or minimum (maximum=false) of observation values
+// -) use a monotonic deque ("ascending maxima/minima") of candidate positions to get O(1) amortized time per
+//    observation
+// -) the deque is stored in a ring buffer, whose capacity is doubled when it is full, so that the memory is bounded by
+//    twice the maximum number of observations in the window instead of the length of the time series
+template <bool maximum>
+class ExtremumAggregator
+{
+public:
+  ExtremumAggregator() : deque(NULL), head(0), tail(0), mask(0) {}
+  ~ExtremumAggregator() { free(deque); }
+  ExtremumAggregator(const ExtremumAggregator&) = delete;
+  ExtremumAggregator& operator=(const ExtremumAggregator&) = delete;
+
+  void reserve(ptrdiff_t size)
+  {
+    mask = ring_buffer_mask(size < RING_BUFFER_INITIAL_CAPACITY ? size : RING_BUFFER_INITIAL_CAPACITY);
+    deque = (ptrdiff_t *) INSTRUMENT_MALLOC((mask + 1) * sizeof(ptrdiff_t));
+  }
+
+  // Positions with values <= (or >=) the new value can never become the maximum (or minimum) again
+  template <typename T> void add(const T values[], ptrdiff_t pos)
+  {
+    while ((tail > head) && (maximum ? (values[deque[(tail - 1) & mask]] <= values[pos]) :
+        (values[deque[(tail - 1) & mask]] >= values[pos]))) {
+      tail--;
+      INSTRUMENT_ADD(elements_touched, 1);
+    }
+    if (tail - head > mask)
+      deque = ring_buffer_grow(deque, head, tail, &mask);
+    deque[tail++ & mask] = pos;
+  }
+
+  // Drop the position leaving the window, if it is still a candidate
+  template <typename T> void remove(const T[], ptrdiff_t pos)
+  {
+    if ((head < tail) && (deque[head & mask] == pos)) {
+      head++;
+      INSTRUMENT_ADD(elements_touched, 1);
+    }
+  }
+
+  template <typename T> double value(const T values[], ptrdiff_t, ptrdiff_t)
+  {
+    if (head < tail)    // non-empty window
+      return values[deque[head & mask]];
+    else                // empty window
+      return maximum ? -INFINITY : INFINITY;
+  }
+
+private:
+  // Positions deque[head & mask], ..., deque[(tail - 1) & mask] inside the rolling window with strictly decreasing (or
+  // increasing) values, where each position is the last one with its value
+  ptrdiff_t *deque, head, tail, mask;
+};
+
+template <bool maximum>
+struct LocalAggregator<ExtremumAggregator<maximum> >
+{
+  explicit LocalAggregator(const ExtremumAggregator<maximum>&) {}
+  ExtremumAggregator<maximum> agg;
+};
+
+typedef ExtremumAggregator<true> MaxAggregator;
+typedef ExtremumAggregator<false> MinAggregator;
+
+
+// Median of observation values
+class MedianAggregator
+{
+public:
+  MedianAggregator() : window(NULL) {}
+  ~MedianAggregator() { if (window != NULL) skiplist_free(window); }
+  MedianAggregator(const MedianAggregator&) = delete;
+  MedianAggregator& operator=(const MedianAggregator&) = delete;
+
+  void reserve(ptrdiff_t) { window = skiplist_create(); }
+  void add(const double values[], ptrdiff_t pos) { skiplist_insert(window, values[pos]); }
+  void remove(const double values[], ptrdiff_t pos) { skiplist_remove(window, values[pos]); }
+  double value(const double[], ptrdiff_t, ptrdiff_t) { return skiplist_median(window); }
+
+private:
+  skiplist *window;   // sorted observation values in rolling window
+};
+
+template <>
+struct LocalAggregator<MedianAggregator>
+{
+  explicit LocalAggregator(const MedianAggregator&) {}
+  MedianAggregator agg;
+};
+
+
+// Product (logarithm=false) or logarithm of the product (logarithm=true) of observation values
+// -) keep the number of zeros and negative values in the window, and a compensated rolling sum of the logarithms of the
+//    absolute values (see log_product_add)
+template <bool logarithm>
+class ProductAggregator : public Aggregator
+{
+public:
+  ProductAggregator() : num_zero(0), num_negative(0), log_sum(0), comp(0) {}
+
+  void add(const double values[], ptrdiff_t pos)
+  {
+    log_product_add(values[pos], &num_zero, &num_negative, &log_sum, &comp);
+  }
+  void remove(const double values[], ptrdiff_t pos)
+  {
+    log_product_remove(values[pos], &num_zero, &num_negative, &log_sum, &comp);
+  }
+  double value(const double values[], ptrdiff_t left, ptrdiff_t right)
+  {
+    // Discard accumulated rounding errors if no non-zero values remain
+    if (right - left + 1 == num_zero)
+      log_sum = comp = 0;
+
+    if (!logarithm)
+      return log_product_value(values, left, right, num_zero, num_negative, log_sum);
+    if (left == right)
+      return std::log(values[left]);
+    if (num_zero > 0)
+      return -INFINITY;
+    if (num_negative % 2 == 1)
+      return NAN;
+    return log_sum;
+  }
+
+private:
+  ptrdiff_t num_zero, num_negative;
+  double log_sum, comp;
+};
+
+
+// Sample variance (sd=false) or sample standard deviation (sd=true) of observation values
+// -) update the mean and sum of squared deviations as observations enter and leave the window
+// -) the removal of observations leaves rounding errors of the order of the machine epsilon times the previous sum of
+//    squared deviations, so the state is reset whenever all observation values in the window are identical, which is
+//    detected by keeping track of the first observation of the run of identical values at the right end of the window
+template <bool sd>
+class VarAggregator : public Aggregator
+{
+public:
+  VarAggregator() : count(0), run_start(0), mean(0), m2(0) {}
+
+  template <typename T> void add(const T values[], ptrdiff_t pos)
+  {
+    if ((count == 0) || (values[pos] != values[pos - 1]))
+      run_start = pos;
+    welford_add(values[pos], &count, &mean, &m2);
+  }
+  template <typename T> void remove(const T values[], ptrdiff_t pos)
+  {
+    welford_remove(values[pos], &count, &mean, &m2);
+  }
+  template <typename T> double value(const T values[], ptrdiff_t left, ptrdiff_t right)
+  {
+    // Discard accumulated rounding errors if all observation values in the window are identical
+    if ((count > 0) && (run_start <= left)) {
+      mean = values[right];
+      m2 = 0;
+    }
+
+    // The sum of squared deviations can become slightly negative due to rounding errors
+    if (count < 2)
+      return NAN;
+    double var = (m2 > 0 ? m2 : 0) / (count - 1);
+    return sd ? std::sqrt(var) : var;
+  }
+
+private:
+  ptrdiff_t count, run_start;
+  double mean, m2;
+};
+
+
+// Quantities that can be calculated from the rolling power sums in PowerSumAggregator
+enum PowerSumMoment {CENTRAL_MOMENT_3, CENTRAL_MOMENT_4, SKEWNESS, KURTOSIS};
+
+
+// Calculate the requested quantity from the power sums of shifted observation values
+// -) kept out of PowerSumAggregator::value(), so that the latter is small enough to be inlined into the kernels
+template <PowerSumMoment type>
+double power_sum_moment(ptrdiff_t count, bool constant, double level, double mean, double m2, double sum2, double sum3, double sum4)
+{
+  // count    ... number of observations in the window
+  // constant ... whether all observation values in the window are identical
+  // level    ... mean of (unshifted) observation values
+  // mean     ... mean of shifted observation values
+  // m2       ... sum of squared deviations from the mean
+  // sum2     ... sum of squares of shifted observation values
+  // sum3     ... sum of 3rd powers of shifted observation values
+  // sum4     ... sum of 4th powers of shifted observation values
+
+  // Sums of 3rd and 4th powers of deviations from the mean
+  double m3 = sum3 - 3 * mean * sum2 + 2 * count * mean * mean * mean;
+  double m4 = sum4 - 4 * mean * sum3 + 6 * mean * mean * sum2 - 3 * count * mean * mean * mean * mean;
+
+  // Calculate the requested quantity for the current time window
+  if (count < 2)
+    return NAN;
+  else if (constant)
+    return (type == CENTRAL_MOMENT_3) || (type == CENTRAL_MOMENT_4) ? 0 : NAN;
+  else if (type == CENTRAL_MOMENT_3)
+    return m3 / (count - 1);
+  else if (type == CENTRAL_MOMENT_4)
+    return m4 / (count - 1);
+  else if (m2 <= DBL_EPSILON * DBL_EPSILON * count * level * level)   // constant values up to rounding errors
+    return NAN;
+  else if (type == SKEWNESS)
+    return std::sqrt((double) count) * m3 / std::pow(m2, 1.5);
+  else
+    return count * m4 / (m2 * m2);
+}
+
+
+// 3rd/4th central moment, skewness, or kurtosis of observation values
+// -) keep compensated rolling sums of the first four powers of the observation values, which allows to calculate
+//    the central moments in O(1) time per observation
+// -) the observation values are shifted by (approximately) the window mean to reduce cancellation errors
+// -) like in VarAggregator, windows with identical observation values are detected by keeping track of the first
+//    observation of the run of identical values at the right end of the window, so that the rounding errors left
+//    behind by removed observations cannot be mistaken for a tiny non-zero variance
+template <PowerSumMoment type>
+class PowerSumAggregator : public Aggregator
+{
+public:
+  PowerSumAggregator() : count(0), run_start(0), shift(0)
+  {
+    reset();
+  }
+
+  void add(const double values[], ptrdiff_t pos)
+  {
+    if ((count == 0) || (values[pos] != values[pos - 1]))
+      run_start = pos;
+    if (count == 0)
+      shift = values[pos];
+    count++;
+    update(values[pos] - shift, 1);
+  }
+
+  void remove(const double values[], ptrdiff_t pos)
+  {
+    count--;
+    if (count == 0)
+      reset();   // avoid carrying over accumulated rounding errors
+    else
+      update(values[pos] - shift, -1);
+  }
+
+  AGGREGATOR_INLINE double value(const double values[], ptrdiff_t left, ptrdiff_t right)
+  {
+    // Recalculate the power sums with a new shift if the window mean drifted too far away from the current shift
+    // -) e.g. for a trending time series; happens rarely, so that the amortized time per observation remains O(1)
+    double mean = sum1 / count;
+    double m2 = sum2 - mean * sum1;
+    if ((count > 0) && (mean * mean > 100 * m2 / count)) {
+      reshift(values, left, right, mean);
+      mean = sum1 / count;
+      m2 = sum2 - mean * sum1;
+    }
+
+    return power_sum_moment<type>(count, run_start <= left, shift + mean, mean, m2, sum2, sum3, sum4);
+  }
+
+private:
+  ptrdiff_t count, run_start;
+  double shift;
+  double sum1, sum2, sum3, sum4;      // sums of powers of shifted values
+  double comp1, comp2, comp3, comp4;  // accumulated numeric error of sums
+
+  void reset()
+  {
+    sum1 = sum2 = sum3 = sum4 = 0;
+    comp1 = comp2 = comp3 = comp4 = 0;
+  }
+
+  // Recalculate the power sums from scratch after increasing the shift
+  void reshift(const double values[], ptrdiff_t left, ptrdiff_t right, double delta)
+  {
+    shift += delta;
+    reset();
+    for (ptrdiff_t pos = left; pos <= right; pos++)
+      update(values[pos] - shift, 1);
+    INSTRUMENT_ADD(rescans, 1);
+    INSTRUMENT_ADD(elements_touched, right - left + 1);
+  }
+
+  // Add (sign=1) or subtract (sign=-1) the powers of a shifted observation value
+  void update(double d, int sign)
+  {
+    double d2 = d * d;
+    compensated_addition(&sum1, sign * d, &comp1);
+    compensated_addition(&sum2, sign * d2, &comp2);
+    compensated_addition(&sum3, sign * d2 * d, &comp3);
+    compensated_addition(&sum4, sign * d2 * d2, &comp4);
+  }
+};
+
+
+// m-th central moment of observation values for general m
+// -) the window mean is calculated from a rolling sum, but the central moment itself is calculated from scratch
+class CentralMomentAggregator : public SumAggregator
+{
+public:
+  explicit CentralMomentAggregator(double m) : m(m) {}
+
+  double value(const double values[], ptrdiff_t left, ptrdiff_t right)
+  {
+    if (left >= right)   // less than two observations in time window
+      return NAN;
+
+    double mean = roll_sum / (right - left + 1), tmp = 0;
+    for (ptrdiff_t pos = left; pos <= right; pos++)
+      tmp = tmp + std::pow(values[pos] - mean, m);
+    INSTRUMENT_ADD(rescans, 1);
+    INSTRUMENT_ADD(elements_touched, right - left + 1);
+    return tmp / (right - left);
+  }
+
+private:
+  double m;
+};
+
+#endif
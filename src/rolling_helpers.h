@@ -0,0 +1,243 @@
+// Copyright: 2012-2018 by Andreas Eckner
+// License: GPL-2 | GPL-3
+// Remark: Helper functions for updating the state of rolling window kernels when an observation enters or leaves the
+//         rolling window, shared by the C kernels in rolling.c and the C++ kernels in rolling_core.cpp
+
+#ifndef _rolling_helpers_h
+#define _rolling_helpers_h
+
+#include <math.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include "instrument.h"
+
+
+// Compensated addition using Kahan (1965) summation algorithm
+static inline void compensated_addition(double *sum, double addend, double *comp)
+{
+  // sum    ... sum calculated so far
+  // addend ... value to be added to 'sum'
+  // comp   ... accumulated numeric error so far
+  
+  double sum_new;
+  
+  addend = addend - *comp;
+  sum_new = *sum + addend;
+  *comp = (sum_new - *sum) - addend;
+  *sum = sum_new;
+}
+
+
+// Compensated addition using Neumaier (1974) summation algorithm, i.e. Kahan summation that also compensates the
+// rounding error if the addend is larger than the sum (e.g. when a large value leaves the rolling window)
+// -) the correction term is kept separately, so that the sum is given by *sum + *comp
+// -) branch-free, so that the compiler can use a conditional move instead of an unpredictable branch
+static inline void neumaier_addition(double *sum, double addend, double *comp)
+{
+  // sum    ... sum calculated so far (without the correction term)
+  // addend ... value to be added to 'sum'
+  // comp   ... accumulated numeric error so far
+  
+  double sum_new = *sum + addend;
+  int sum_larger = fabs(*sum) >= fabs(addend);
+  double larger = sum_larger ? *sum : addend;
+  double smaller = sum_larger ? addend : *sum;
+  *comp += (larger - sum_new) + smaller;
+  *sum = sum_new;
+}
+
+
+// Add an observation value to the running mean and sum of squared deviations (Welford, 1962)
+static inline void welford_add(double value, ptrdiff_t *count, double *mean, double *m2)
+{
+  // value ... value to be added
+  // count ... number of values so far
+  // mean  ... mean of values so far
+  // m2    ... sum of squared deviations from the mean so far
+  
+  double delta = value - *mean;
+  (*count)++;
+  *mean += delta / *count;
+  *m2 += delta * (value - *mean);
+}
+
+
+// Remove an observation value from the running mean and sum of squared deviations (West, 1979)
+static inline void welford_remove(double value, ptrdiff_t *count, double *mean, double *m2)
+{
+  // value ... value to be removed
+  // count ... number of values so far
+  // mean  ... mean of values so far
+  // m2    ... sum of squared deviations from the mean so far
+  
+  (*count)--;
+  if (*count == 0) {
+    // Reset to avoid carrying over accumulated rounding errors
+    *mean = 0;
+    *m2 = 0;
+  } else {
+    double delta = value - *mean;
+    *mean -= delta / *count;
+    *m2 -= delta * (value - *mean);
+  }
+}
+
+
+
+// Add an observation value to the number of zeros, the number of negative values, and the compensated sum of the
+// logarithms of the absolute values of the non-zero values, which together determine the product of the values
+static inline void log_product_add(double value, ptrdiff_t *num_zero, ptrdiff_t *num_negative, double *log_sum,
+  double *comp)
+{
+  // value        ... value to be added
+  // num_zero     ... number of zeros so far
+  // num_negative ... number of negative values so far
+  // log_sum      ... sum of log(|value|) of non-zero values so far
+  // comp         ... accumulated numeric error of 'log_sum' so far
+  
+  if (value == 0)
+    (*num_zero)++;
+  else {
+    if (value < 0)
+      (*num_negative)++;
+    compensated_addition(log_sum, log(fabs(value)), comp);
+  }
+}
+
+
+// Remove an observation value from the state of log_product_add()
+static inline void log_product_remove(double value, ptrdiff_t *num_zero, ptrdiff_t *num_negative, double *log_sum,
+  double *comp)
+{
+  // value        ... value to be removed
+  // num_zero     ... number of zeros so far
+  // num_negative ... number of negative values so far
+  // log_sum      ... sum of log(|value|) of non-zero values so far
+  // comp         ... accumulated numeric error of 'log_sum' so far
+  
+  if (value == 0)
+    (*num_zero)--;
+  else {
+    if (value < 0)
+      (*num_negative)--;
+    compensated_addition(log_sum, -log(fabs(value)), comp);
+  }
+}
+
+
+// Return the product of the observation values in a window from the state of log_product_add()
+// -) the product of a single observation value is returned exactly
+static inline double log_product_value(const double values[], ptrdiff_t left, ptrdiff_t right, ptrdiff_t num_zero,
+  ptrdiff_t num_negative, double log_sum)
+{
+  // values       ... array of time series values
+  // left         ... index of first observation in window
+  // right        ... index of last observation in window
+  // num_zero     ... number of zeros in window
+  // num_negative ... number of negative values in window
+  // log_sum      ... sum of log(|value|) of non-zero values in window
+  
+  if (left == right)
+    return values[left];
+  if (num_zero > 0)
+    return 0;
+  return (num_negative % 2 == 1) ? -exp(log_sum) : exp(log_sum);
+}
+
+
+// Return the maximum number of observations that are simultaneously inside a rolling window with half-open interval
+// (t_i - width_before, t_i + width_after], when the window is first expanded on the right and then shrunk on the left
+// -) used to size the ring buffers of monotonic deques, so that their memory is bounded by the window size instead of
+//    the length of the time series
+static inline ptrdiff_t max_window_span(const double times[], ptrdiff_t n, double width_before, double width_after)
+{
+  // times        ... array of observation times
+  // n            ... number of observations, i.e. length of 'times'
+  // width_before ... (non-negative) width of rolling window before t_i
+  // width_after  ... (non-negative) width of rolling window after t_i
+  
+  ptrdiff_t left = 0, right = -1, span = 1;
+  
+  for (ptrdiff_t i = 0; i < n; i++) {
+    while ((right < n - 1) && (times[right + 1] <= times[i] + width_after))
+      right++;
+    if (right - left + 1 > span)
+      span = right - left + 1;
+    while ((left < n) && (times[left] <= times[i] - width_before))
+      left++;
+  }
+  return span;
+}
+
+
+// Return the index mask of a ring buffer that can hold at least 'size' elements, i.e. the smallest power of two that
+// is at least 'size' minus one
+static inline ptrdiff_t ring_buffer_mask(ptrdiff_t size)
+{
+  ptrdiff_t capacity = 1;
+  
+  while (capacity < size)
+    capacity *= 2;
+  return capacity - 1;
+}
+
+
+// Initial capacity of growable deque buffers (see ring_buffer_grow and deque_make_room)
+#define RING_BUFFER_INITIAL_CAPACITY 256
+
+
+// Double the capacity of a ring buffer holding the positions buffer[head & mask], ..., buffer[(tail - 1) & mask], and
+// return the new buffer
+// -) lets monotonic deques start small, so that their memory is bounded by twice the maximum window size without a
+//    separate pass over the observation times
+static inline ptrdiff_t *ring_buffer_grow(ptrdiff_t buffer[], ptrdiff_t head, ptrdiff_t tail, ptrdiff_t *mask)
+{
+  // buffer ... ring buffer, which is freed
+  // head   ... index of the first element
+  // tail   ... index after the last element
+  // mask   ... index mask of the ring buffer, which is updated
+  
+  ptrdiff_t mask_new = 2 * *mask + 1;
+  ptrdiff_t *buffer_new = (ptrdiff_t *) INSTRUMENT_MALLOC((mask_new + 1) * sizeof(ptrdiff_t));
+  
+  for (ptrdiff_t j = head; j < tail; j++)
+    buffer_new[j & mask_new] = buffer[j & *mask];
+  free(buffer);
+  *mask = mask_new;
+  return buffer_new;
+}
+
+// Make room for 'num_new' positions at the end of a deque stored in buffer[head], ..., buffer[tail - 1], and return
+// the new buffer
+// -) the deque is moved to the front of the buffer if this frees enough space, and the capacity is doubled otherwise,
+//    so that the capacity stays below four times the maximum of the deque size plus 'num_new', and each position is
+//    copied O(1) times on average
+static inline ptrdiff_t *deque_make_room(ptrdiff_t buffer[], ptrdiff_t *head, ptrdiff_t *tail, ptrdiff_t *capacity,
+  ptrdiff_t num_new)
+{
+  // buffer   ... deque buffer, which is freed if the capacity is increased
+  // head     ... index of the first element, which is updated
+  // tail     ... index after the last element, which is updated
+  // capacity ... capacity of 'buffer', which is updated
+  // num_new  ... number of positions to be added
+  
+  ptrdiff_t size = *tail - *head;
+  
+  if (*tail + num_new <= *capacity)
+    return buffer;
+  if (2 * (size + num_new) > *capacity) {
+    while (2 * (size + num_new) > *capacity)
+      *capacity *= 2;
+    ptrdiff_t *buffer_new = (ptrdiff_t *) INSTRUMENT_MALLOC(*capacity * sizeof(ptrdiff_t));
+    memcpy(buffer_new, buffer + *head, size * sizeof(ptrdiff_t));
+    free(buffer);
+    buffer = buffer_new;
+  } else
+    memmove(buffer, buffer + *head, size * sizeof(ptrdiff_t));
+  *head = 0;
+  *tail = size;
+  return buffer;
+}
+
+#endif
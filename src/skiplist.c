@@ -0,0 +1,282 @@
+// Copyright: 2012-2018 by Andreas Eckner
+// License: GPL-2 | GPL-3
+
+#include <math.h>
+#include <stdlib.h>
+#ifdef UTS_STANDALONE
+#include <stdio.h>
+#else
+#include <R_ext/Error.h>
+#endif
+#include "instrument.h"
+#include "skiplist.h"
+
+
+// Link to the next node on a given level, together with the number of positions skipped by following it
+typedef struct {
+  skiplist_node *next;
+  ptrdiff_t width;
+} skiplist_link;
+
+struct skiplist_node {
+  double value;
+  int level;                  // number of links
+  skiplist_link link[];       // link[0] ... link[level - 1]
+};
+
+
+// Allocate memory, and give up if not enough memory is available
+static void *checked_malloc(size_t size)
+{
+  // size ... number of bytes
+
+  void *ptr = INSTRUMENT_MALLOC(size);
+  if (ptr == NULL) {
+#ifdef UTS_STANDALONE
+    fprintf(stderr, "Cannot allocate memory for skiplist\n");
+    exit(1);
+#else
+    Rf_error("Cannot allocate memory for skiplist");
+#endif
+  }
+  return ptr;
+}
+
+
+// Draw the number of levels of a new node from a geometric distribution with p=1/2
+static inline int random_level(skiplist *sl)
+{
+  // sl ... skiplist
+
+  // xorshift32 random number generator (Marsaglia, 2003)
+  unsigned int x = sl->rng_state;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  sl->rng_state = x;
+
+  int level = 1;
+  while ((x & 1) && (level < SKIPLIST_MAX_LEVEL)) {
+    level++;
+    x >>= 1;
+  }
+  return level;
+}
+
+
+// Allocate a node with the given number of levels, reusing a previously removed node if possible
+static inline skiplist_node *new_node(skiplist *sl, double value, int level)
+{
+  // sl    ... skiplist
+  // value ... value to be stored in node
+  // level ... number of levels (i.e. links) of node
+
+  skiplist_node *node = sl->free_nodes[level - 1];
+  if (node != NULL)
+    sl->free_nodes[level - 1] = node->link[0].next;
+  else {
+    node = checked_malloc(sizeof(skiplist_node) + level * sizeof(skiplist_link));
+    node->level = level;
+  }
+  node->value = value;
+  return node;
+}
+
+
+// Create an empty skiplist
+skiplist *skiplist_create(void)
+{
+  skiplist *sl = checked_malloc(sizeof(skiplist));
+
+  sl->head = checked_malloc(sizeof(skiplist_node) + SKIPLIST_MAX_LEVEL * sizeof(skiplist_link));
+  sl->head->level = SKIPLIST_MAX_LEVEL;
+  sl->head->link[0].next = NULL;
+  sl->head->link[0].width = 1;
+  sl->size = 0;
+  sl->levels = 1;
+  sl->rng_state = 2463534242u;
+  for (int level = 0; level < SKIPLIST_MAX_LEVEL; level++)
+    sl->free_nodes[level] = NULL;
+  return sl;
+}
+
+
+// Free all memory used by a skiplist
+void skiplist_free(skiplist *sl)
+{
+  // sl ... skiplist
+
+  skiplist_node *node, *next;
+
+  // Nodes in use
+  for (node = sl->head->link[0].next; node != NULL; node = next) {
+    next = node->link[0].next;
+    free(node);
+  }
+
+  // Recycled nodes
+  for (int level = 0; level < SKIPLIST_MAX_LEVEL; level++) {
+    for (node = sl->free_nodes[level]; node != NULL; node = next) {
+      next = node->link[0].next;
+      free(node);
+    }
+  }
+  free(sl->head);
+  free(sl);
+}
+
+
+// Insert a value in O(log(size)) expected time
+void skiplist_insert(skiplist *sl, double value)
+{
+  // sl    ... skiplist
+  // value ... value to be inserted
+
+  skiplist_node *chain[SKIPLIST_MAX_LEVEL];   // rightmost node on each level that precedes the new node
+  ptrdiff_t steps_at_level[SKIPLIST_MAX_LEVEL];   // number of positions moved forward on each level
+  int level;
+  ptrdiff_t steps;
+
+  // Activate additional levels, if needed
+  int new_level = random_level(sl);
+  for (level = sl->levels; level < new_level; level++) {
+    sl->head->link[level].next = NULL;
+    sl->head->link[level].width = sl->size + 1;
+  }
+  if (new_level > sl->levels)
+    sl->levels = new_level;
+
+  // Find the insertion position on each level
+  skiplist_node *node = sl->head;
+  for (level = sl->levels - 1; level >= 0; level--) {
+    steps_at_level[level] = 0;
+    while ((node->link[level].next != NULL) && (node->link[level].next->value <= value)) {
+      steps_at_level[level] += node->link[level].width;
+      node = node->link[level].next;
+      INSTRUMENT_ADD(elements_touched, 1);
+    }
+    chain[level] = node;
+  }
+
+  // Splice in the new node and update the link widths
+  skiplist_node *node_new = new_node(sl, value, new_level);
+  steps = 0;
+  for (level = 0; level < new_level; level++) {
+    node = chain[level];
+    node_new->link[level].next = node->link[level].next;
+    node->link[level].next = node_new;
+    node_new->link[level].width = node->link[level].width - steps;
+    node->link[level].width = steps + 1;
+    steps += steps_at_level[level];
+  }
+  for (level = new_level; level < sl->levels; level++)
+    chain[level]->link[level].width++;
+  sl->size++;
+}
+
+
+// Remove one occurrence of a value in O(log(size)) expected time. Return 1 if successful, and 0 if the value is not found.
+int skiplist_remove(skiplist *sl, double value)
+{
+  // sl    ... skiplist
+  // value ... value to be removed
+
+  skiplist_node *chain[SKIPLIST_MAX_LEVEL];   // rightmost node on each level that precedes the removed node
+  int level;
+
+  // Find the rightmost node smaller than 'value' on each level
+  skiplist_node *node = sl->head;
+  for (level = sl->levels - 1; level >= 0; level--) {
+    while ((node->link[level].next != NULL) && (node->link[level].next->value < value)) {
+      node = node->link[level].next;
+      INSTRUMENT_ADD(elements_touched, 1);
+    }
+    chain[level] = node;
+  }
+  skiplist_node *node_old = chain[0]->link[0].next;
+  if ((node_old == NULL) || (node_old->value != value))
+    return 0;
+
+  // Unlink the node and update the link widths
+  for (level = 0; level < node_old->level; level++) {
+    node = chain[level];
+    node->link[level].width += node_old->link[level].width - 1;
+    node->link[level].next = node_old->link[level].next;
+  }
+  for (level = node_old->level; level < sl->levels; level++)
+    chain[level]->link[level].width--;
+  sl->size--;
+
+  // Recycle the node
+  node_old->link[0].next = sl->free_nodes[node_old->level - 1];
+  sl->free_nodes[node_old->level - 1] = node_old;
+  return 1;
+}
+
+
+// Return the k-th smallest value (counting starts at zero) in O(log(size)) expected time
+double skiplist_get(const skiplist *sl, ptrdiff_t k)
+{
+  // sl ... skiplist
+  // k  ... return k-th smallest value
+
+  if ((k < 0) || (k >= sl->size))
+    return NAN;
+
+  const skiplist_node *node = sl->head;
+  ptrdiff_t i = k + 1;
+  for (int level = sl->levels - 1; level >= 0; level--) {
+    while (node->link[level].width <= i) {
+      i -= node->link[level].width;
+      node = node->link[level].next;
+      INSTRUMENT_ADD(elements_touched, 1);
+    }
+  }
+  return node->value;
+}
+
+
+// Return the median of the stored values (NAN if empty)
+double skiplist_median(const skiplist *sl)
+{
+  // sl ... skiplist
+
+  if (sl->size == 0)
+    return NAN;
+
+  // Determine the mid points
+  ptrdiff_t mid_low = (sl->size - 1) / 2;
+  ptrdiff_t mid_high = sl->size - mid_low - 1;
+  double value_low = skiplist_get(sl, mid_low);
+
+  if (mid_low < mid_high)   // even number of elements -> two mid points
+    return (value_low + skiplist_get(sl, mid_high)) / 2;
+  else
+    return value_low;
+}
+
+
+// Return the sample quantile of the stored values for probability p (NAN if empty)
+// -) uses the same interpolation (and order of floating-point operations) as quantile(..., type=7) in R
+double skiplist_quantile(const skiplist *sl, double p)
+{
+  // sl ... skiplist
+  // p  ... probability in [0, 1]
+
+  if (sl->size == 0)
+    return NAN;
+
+  // Determine the two closest order statistics
+  double index = 1 + (sl->size - 1) * p;
+  double lo = floor(index);
+  double value_lo = skiplist_get(sl, (ptrdiff_t) lo - 1);
+  if (index == lo)
+    return value_lo;
+  double value_hi = skiplist_get(sl, (ptrdiff_t) ceil(index) - 1);
+
+  // Linear interpolation
+  if (value_hi == value_lo)
+    return value_lo;
+  double h = index - lo;
+  return (1 - h) * value_lo + h * value_hi;
+}
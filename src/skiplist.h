@@ -0,0 +1,34 @@
+// Copyright: 2012-2018 by Andreas Eckner
+// License: GPL-2 | GPL-3
+// Remark: Indexable skiplist (see R. Hettinger, "Efficient Running Median using an Indexable Skiplist") for
+//         maintaining a sorted multiset of observation values in a rolling time window
+
+#ifndef _skiplist_h
+#define _skiplist_h
+
+#include <stddef.h>
+
+#define SKIPLIST_MAX_LEVEL 32
+
+// Node with a variable number of links, only defined in skiplist.c
+typedef struct skiplist_node skiplist_node;
+
+typedef struct {
+  skiplist_node *head;                              // sentinel with SKIPLIST_MAX_LEVEL links
+  ptrdiff_t size;                                   // number of stored values
+  int levels;                                       // number of levels currently in use
+  unsigned int rng_state;                           // state of xorshift random number generator
+  skiplist_node *free_nodes[SKIPLIST_MAX_LEVEL];    // recycled nodes, by level
+} skiplist;
+
+// -) the stored values must not be NaN, because a NaN cannot be located (and therefore not be removed) by comparisons
+// -) if memory cannot be allocated, an R error is raised (or the program exits, if compiled with -DUTS_STANDALONE)
+skiplist *skiplist_create(void);
+void skiplist_free(skiplist *sl);
+void skiplist_insert(skiplist *sl, double value);
+int skiplist_remove(skiplist *sl, double value);
+double skiplist_get(const skiplist *sl, ptrdiff_t k);
+double skiplist_median(const skiplist *sl);
+double skiplist_quantile(const skiplist *sl, double p);
+
+#endif
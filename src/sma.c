@@ -1,7 +1,11 @@
 // Copyright: 2012-2018 by Andreas Eckner
 // License: GPL-2 | GPL-3
 
+#include <stdlib.h>
+#include "instrument.h"
+#include "parallel.h"
 #include "sma.h"
+#include "trapezoid.h"
 
 #ifndef MAX
 #  define MAX(a,b) (((a) > (b)) ? (a) : (b))
@@ -12,39 +16,61 @@
 #endif
 
 
-// Calculate the area of the trapezoid with corner coordinates (x2, 0), (x2, y2), (x3, 0), (x3, y3),
-// where y2 is obtained by linear interpolation of (x1, y1) and (x3, y3) evaluated at x2.
-static inline double trapezoid_left(double x1, double x2, double x3, double y1, double y3)
+// Kernels for double and float observation values, compiled from the same source code in sma_template.h
+#define VALUE_TYPE double
+#define KERNEL_NAME(name) name##_long
+#define RANGE_NAME(name) name##_range
+#include "sma_template.h"
+#undef VALUE_TYPE
+#undef KERNEL_NAME
+#undef RANGE_NAME
+
+#define VALUE_TYPE float
+#define KERNEL_NAME(name) name##_float_long
+#define RANGE_NAME(name) name##_float_range
+#include "sma_template.h"
+#undef VALUE_TYPE
+#undef KERNEL_NAME
+#undef RANGE_NAME
+
+
+// SMA_last(X, width) using several threads
+void sma_last_parallel_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_threads, const int *min_chunk)
 {
-  // Degenerate cases
-  if ((x2 == x3) || (x2 < x1))
-    return (x3 - x2) * y1;
+  // values       ... array of time series values
+  // times        ... array of observation times
+  // n            ... number of observations, i.e. length of 'values' and 'times'
+  // values_new   ... array of length *n to store output time series values
+  // width_before ... (non-negative) width of rolling window before t_i
+  // width_after  ... (non-negative) width of rolling window after t_i
+  // num_threads  ... maximum number of threads to use
+  // min_chunk    ... minimum number of output positions per thread
   
-  // Find y2 using linear interpolation and calculate the trapezoid area
-  double w = (x3 - x2) / (x3 - x1);
-  double y2 = y1 * w + y3 * (1 - w);
-  return (x3 - x2) * (y2 + y3) / 2;
+  apply_range_kernel(sma_last_range, values, times, n, values_new, width_before, width_after, num_threads, min_chunk);
 }
 
 
-// Calculate the area of the trapezoid with corner coordinates (x1, 0), (x1, y1), (x2, 0), (x2, y2),
-// where y2 is obtained by linear interpolation of (x1, y1) and (x3, y3) evaluated at x2.
-static inline double trapezoid_right(double x1, double x2, double x3, double y1, double y3)
+// SMA_next(X, width) using several threads
+void sma_next_parallel_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_threads, const int *min_chunk)
 {
-  // Degenerate cases
-  if ((x2 == x1) || (x2 > x3))
-    return (x2 - x1) * y1;
+  // values       ... array of time series values
+  // times        ... array of observation times
+  // n            ... number of observations, i.e. length of 'values' and 'times'
+  // values_new   ... array of length *n to store output time series values
+  // width_before ... (non-negative) width of rolling window before t_i
+  // width_after  ... (non-negative) width of rolling window after t_i
+  // num_threads  ... maximum number of threads to use
+  // min_chunk    ... minimum number of output positions per thread
   
-  // Find y2 using linear interpolation and calculate the trapezoid area
-  double w = (x3 - x2) / (x3 - x1);
-  double y2 = y1 * w + y3 * (1 - w);
-  return (x2 - x1) * (y1 + y2) / 2;
+  apply_range_kernel(sma_next_range, values, times, n, values_new, width_before, width_after, num_threads, min_chunk);
 }
 
 
-// SMA_last(X, width)
-void sma_last(const double values[], const double times[], const int *n, double values_new[],
-  const double *width_before, const double *width_after)
+// SMA_linear(X, width) using several threads
+void sma_linear_parallel_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_threads, const int *min_chunk)
 {
   // values       ... array of time series values
   // times        ... array of observation times
@@ -52,150 +78,542 @@ void sma_last(const double values[], const double times[], const int *n, double
   // values_new   ... array of length *n to store output time series values
   // width_before ... (non-negative) width of rolling window before t_i
   // width_after  ... (non-negative) width of rolling window after t_i
+  // num_threads  ... maximum number of threads to use
+  // min_chunk    ... minimum number of output positions per thread
+  
+  apply_range_kernel(sma_linear_range, values, times, n, values_new, width_before, width_after, num_threads, min_chunk);
+}
+
+
+
+/************ Batch versions for several time series with identical observation times ************/
+// -) the observation values of the time series are stored in row-major order, i.e. values[k + j * *num_cols] is the
+//    j-th observation value of the k-th time series, and the output is stored in the same way
+// -) the rolling window and all time differences are determined only once, and the inner loop runs over all time
+//    series, i.e. over contiguous memory, so that it can be vectorized
+
+
+// SMA_last(X, width) for several time series
+void sma_last_batch_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_cols)
+{
+  // values       ... array of length *n * *num_cols of time series values
+  // times        ... array of observation times
+  // n            ... number of observations, i.e. length of 'times'
+  // values_new   ... array of length *n * *num_cols to store output time series values
+  // width_before ... (non-negative) width of rolling window before t_i
+  // width_after  ... (non-negative) width of rolling window after t_i
+  // num_cols     ... number of time series
   
-  int left = 0, right = 0;
-  double t_left_new, t_right_new, roll_area, left_area, right_area = 0;
+  ptrdiff_t left = 0, right = 0;
+  int k;
+  double t_left_new, t_right_new, dt, dt_left, dt_right, *row_new;
+  const double *row, *row_left, *row_right;
+  const double width = *width_before + *width_after;
   
   // Trivial case
   if (*n == 0)
     return;
   
-  // Initialize output
-  values_new[0] = values[0];  
-  roll_area = left_area = values[0] * (*width_before + *width_after);
+  // Initialize output. The causal rolling time window of the first observation only covers the constant sample path
+  // before it, and otherwise start with an empty window, which is then expanded on the right end in the first iteration
+  double *roll_area = INSTRUMENT_CALLOC(*num_cols, sizeof(double));
+  double *left_area = INSTRUMENT_CALLOC(*num_cols, sizeof(double));
+  double *right_area = INSTRUMENT_CALLOC(*num_cols, sizeof(double));
+  ptrdiff_t start = 0;
+  if (*width_after == 0) {
+    for (k = 0; k < *num_cols; k++) {
+      values_new[k] = values[k];
+      roll_area[k] = left_area[k] = values[k] * width;
+    }
+    start = 1;
+  }
   
   // Apply rolling window
-  for (int i = 1; i < *n; i++) {
+  for (ptrdiff_t i = start; i < *n; i++) {
     // Remove truncated area on left and right end
-    roll_area -= (left_area + right_area);
+    for (k = 0; k < *num_cols; k++)
+      roll_area[k] -= (left_area[k] + right_area[k]);
     
     // Expand interval on right end
     t_right_new = times[i] + *width_after;
     while ((right < *n - 1) && (times[right + 1] <= t_right_new)) {
       right++;
-      roll_area += values[right - 1] * (times[right] - times[right - 1]);
+      dt = times[right] - times[right - 1];
+      row = values + (size_t) (right - 1) * *num_cols;
+      for (k = 0; k < *num_cols; k++)
+        roll_area[k] += row[k] * dt;
     }
     
     // Shrink interval on left end
     t_left_new = times[i] - *width_before;
     while (times[left] < t_left_new) {
-      roll_area -= values[left] * (times[left+1] - times[left]);
+      dt = times[left+1] - times[left];
+      row = values + (size_t) left * *num_cols;
+      for (k = 0; k < *num_cols; k++)
+        roll_area[k] -= row[k] * dt;
       left++;  
     }
     
-    // Add truncated area on left and right end
-    left_area = values[MAX(0, left-1)] * (times[left] - t_left_new);
-    right_area = values[right] * (t_right_new - times[right]);
-    roll_area += left_area + right_area;
-    
-    // Save SMA value for current time window
-    values_new[i] = roll_area / (*width_before + *width_after);
+    // Add truncated area on left and right end, and save SMA value for current time window
+    dt_left = times[left] - t_left_new;
+    dt_right = t_right_new - times[right];
+    row_left = values + (size_t) MAX(0, left-1) * *num_cols;
+    row_right = values + (size_t) right * *num_cols;
+    row_new = values_new + (size_t) i * *num_cols;
+    for (k = 0; k < *num_cols; k++) {
+      left_area[k] = row_left[k] * dt_left;
+      right_area[k] = row_right[k] * dt_right;
+      roll_area[k] += left_area[k] + right_area[k];
+      row_new[k] = roll_area[k] / width;
+    }
   }
+  INSTRUMENT_WINDOW(right, left);
+  free(roll_area);
+  free(left_area);
+  free(right_area);
 }
 
 
-// SMA_next(X, width)
-void sma_next(const double values[], const double times[], const int *n, double values_new[],
-  const double *width_before, const double *width_after)
+// SMA_next(X, width) for several time series
+void sma_next_batch_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_cols)
 {
-  // values       ... array of time series values
+  // values       ... array of length *n * *num_cols of time series values
   // times        ... array of observation times
-  // n            ... number of observations, i.e. length of 'values' and 'times'
-  // values_new   ... array of length *n to store output time series values
+  // n            ... number of observations, i.e. length of 'times'
+  // values_new   ... array of length *n * *num_cols to store output time series values
   // width_before ... (non-negative) width of rolling window before t_i
   // width_after  ... (non-negative) width of rolling window after t_i
+  // num_cols     ... number of time series
   
-  int left = 0, right = 0;
-  double t_left_new, t_right_new, roll_area, left_area, right_area = 0;
+  ptrdiff_t left = 0, right = 0;
+  int k;
+  double t_left_new, t_right_new, dt, dt_left, dt_right, *row_new;
+  const double *row, *row_left, *row_right;
+  const double width = *width_before + *width_after;
   
   // Trivial case
   if (*n == 0)
     return;
   
-  // Initialize output
-  values_new[0] = values[0];  
-  roll_area = left_area = values[0] * (*width_before + *width_after);
+  // Initialize output. The causal rolling time window of the first observation only covers the constant sample path
+  // before it, and otherwise start with an empty window, which is then expanded on the right end in the first iteration
+  double *roll_area = INSTRUMENT_CALLOC(*num_cols, sizeof(double));
+  double *left_area = INSTRUMENT_CALLOC(*num_cols, sizeof(double));
+  double *right_area = INSTRUMENT_CALLOC(*num_cols, sizeof(double));
+  ptrdiff_t start = 0;
+  if (*width_after == 0) {
+    for (k = 0; k < *num_cols; k++) {
+      values_new[k] = values[k];
+      roll_area[k] = left_area[k] = values[k] * width;
+    }
+    start = 1;
+  }
   
   // Apply rolling window
-  for (int i = 1; i < *n; i++) {
+  for (ptrdiff_t i = start; i < *n; i++) {
     // Remove truncated area on left and right end
-    roll_area -= (left_area + right_area);
+    for (k = 0; k < *num_cols; k++)
+      roll_area[k] -= (left_area[k] + right_area[k]);
     
     // Expand interval on right end
     t_right_new = times[i] + *width_after;
     while ((right < *n - 1) && (times[right + 1] <= t_right_new)) {
       right++;
-      roll_area += values[right] * (times[right] - times[right - 1]);
+      dt = times[right] - times[right - 1];
+      row = values + (size_t) right * *num_cols;
+      for (k = 0; k < *num_cols; k++)
+        roll_area[k] += row[k] * dt;
     }
     
     // Shrink interval on left end
     t_left_new = times[i] - *width_before;
     while (times[left] < t_left_new) {
-      roll_area -= values[left+1] * (times[left+1] - times[left]);
+      dt = times[left+1] - times[left];
+      row = values + (size_t) (left + 1) * *num_cols;
+      for (k = 0; k < *num_cols; k++)
+        roll_area[k] -= row[k] * dt;
       left++;  
     }
     
-    // Add truncated area on left and rigth end
-    left_area = values[left] * (times[left] - t_left_new);
-    right_area = values[right] * (t_right_new - times[right]);
-    roll_area += left_area + right_area;
-    
-    // Save SMA value for current time window
-    values_new[i] = roll_area / (*width_before + *width_after);
+    // Add truncated area on left and right end, and save SMA value for current time window
+    dt_left = times[left] - t_left_new;
+    dt_right = t_right_new - times[right];
+    row_left = values + (size_t) left * *num_cols;
+    row_right = values + (size_t) MIN(right+1, *n-1) * *num_cols;
+    row_new = values_new + (size_t) i * *num_cols;
+    for (k = 0; k < *num_cols; k++) {
+      left_area[k] = row_left[k] * dt_left;
+      right_area[k] = row_right[k] * dt_right;
+      roll_area[k] += left_area[k] + right_area[k];
+      row_new[k] = roll_area[k] / width;
+    }
   }
+  INSTRUMENT_WINDOW(right, left);
+  free(roll_area);
+  free(left_area);
+  free(right_area);
 }
 
 
-// SMA_linear(X, width)
-void sma_linear(const double values[], const double times[], const int *n, double values_new[],
-  const double *width_before, const double *width_after)
+// SMA_linear(X, width) for several time series
+void sma_linear_batch_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_cols)
 {
-  // values       ... array of time series values
+  // values       ... array of length *n * *num_cols of time series values
   // times        ... array of observation times
-  // n            ... number of observations, i.e. length of 'values' and 'times'
-  // values_new   ... array of length *n to store output time series values
+  // n            ... number of observations, i.e. length of 'times'
+  // values_new   ... array of length *n * *num_cols to store output time series values
   // width_before ... (non-negative) width of rolling window before t_i
   // width_after  ... (non-negative) width of rolling window after t_i
+  // num_cols     ... number of time series
   
-  int left = 0, right = 0;
-  double t_left_new, t_right_new, roll_area, left_area, right_area = 0;
+  ptrdiff_t left = 0, right = 0, pos_left, pos_right;
+  int k, degenerate_left, degenerate_right;
+  double t_left_new, t_right_new, dt, x1, x3, w_left, w_right, y2, *row_new;
+  const double *row, *row_left, *row_right;
+  const double width = *width_before + *width_after;
   
   // Trivial case
   if (*n == 0)
     return;
   
-  // Initialize output
-  values_new[0] = values[0];
-  roll_area = left_area = values[0] * (*width_before + *width_after);
+  // Initialize output. The causal rolling time window of the first observation only covers the constant sample path
+  // before it, and otherwise start with an empty window, which is then expanded on the right end in the first iteration
+  double *roll_area = INSTRUMENT_CALLOC(*num_cols, sizeof(double));
+  double *left_area = INSTRUMENT_CALLOC(*num_cols, sizeof(double));
+  double *right_area = INSTRUMENT_CALLOC(*num_cols, sizeof(double));
+  ptrdiff_t start = 0;
+  if (*width_after == 0) {
+    for (k = 0; k < *num_cols; k++) {
+      values_new[k] = values[k];
+      roll_area[k] = left_area[k] = values[k] * width;
+    }
+    start = 1;
+  }
   
   // Apply rolling window
-  for (int i = 1; i < *n; i++) {   
+  for (ptrdiff_t i = start; i < *n; i++) {   
     // Remove truncated area on left and right end
-    roll_area -= (left_area + right_area);
+    for (k = 0; k < *num_cols; k++)
+      roll_area[k] -= (left_area[k] + right_area[k]);
     
     // Expand interval on right end
     t_right_new = times[i] + *width_after;
     while ((right < *n - 1) && (times[right + 1] <= t_right_new)) {
       right++;
-      roll_area += (values[right] + values[right - 1])/2 * (times[right] - times[right - 1]);
+      dt = times[right] - times[right - 1];
+      row = values + (size_t) right * *num_cols;
+      for (k = 0; k < *num_cols; k++)
+        roll_area[k] += (row[k] + row[k - *num_cols])/2 * dt;
     }
     
     // Shrink interval on left end
     t_left_new = times[i] - *width_before;
     while (times[left] < t_left_new) {
-      roll_area -= (values[left] + values[left+1]) / 2 *
-        (times[left+1] - times[left]);
+      dt = times[left+1] - times[left];
+      row = values + (size_t) left * *num_cols;
+      for (k = 0; k < *num_cols; k++)
+        roll_area[k] -= (row[k] + row[k + *num_cols]) / 2 * dt;
       left++;  
     }
     
-    // Add truncated area on left and right end
-    left_area = trapezoid_left(times[MAX(0, left-1)], t_left_new, times[left],
-      values[MAX(0, left-1)], values[left]);
-    right_area = trapezoid_right(times[right], t_right_new, times[MIN(right+1, *n-1)],
-      values[right], values[MIN(right+1, *n-1)]);
-    roll_area += left_area + right_area;
+    // Interpolation weights of the truncated areas on left and right end (see trapezoid_left and trapezoid_right)
+    pos_left = MAX(0, left-1);
+    x1 = times[pos_left];
+    x3 = times[left];
+    degenerate_left = (t_left_new == x3) || (t_left_new < x1);
+    w_left = degenerate_left ? 0 : (x3 - t_left_new) / (x3 - x1);
+    pos_right = MIN(right+1, *n-1);
+    x1 = times[right];
+    x3 = times[pos_right];
+    degenerate_right = (t_right_new == x1) || (t_right_new > x3);
+    w_right = degenerate_right ? 0 : (x3 - t_right_new) / (x3 - x1);
+    
+    // Add truncated area on left and right end, and save SMA value for current time window
+    const double *row_pos_left = values + (size_t) pos_left * *num_cols;
+    const double *row_pos_right = values + (size_t) pos_right * *num_cols;
+    row_left = values + (size_t) left * *num_cols;
+    row_right = values + (size_t) right * *num_cols;
+    row_new = values_new + (size_t) i * *num_cols;
+    for (k = 0; k < *num_cols; k++) {
+      if (degenerate_left)
+        left_area[k] = (times[left] - t_left_new) * row_pos_left[k];
+      else {
+        y2 = row_pos_left[k] * w_left + row_left[k] * (1 - w_left);
+        left_area[k] = (times[left] - t_left_new) * (y2 + row_left[k]) / 2;
+      }
+      if (degenerate_right)
+        right_area[k] = (t_right_new - times[right]) * row_right[k];
+      else {
+        y2 = row_right[k] * w_right + row_pos_right[k] * (1 - w_right);
+        right_area[k] = (t_right_new - times[right]) * (row_right[k] + y2) / 2;
+      }
+      roll_area[k] += left_area[k] + right_area[k];
+      row_new[k] = roll_area[k] / width;
+    }
+  }
+  INSTRUMENT_WINDOW(right, left);
+  free(roll_area);
+  free(left_area);
+  free(right_area);
+}
+
+
+
+/************ Versions with output at arbitrary query times ************/
+// -) the output values are SMA(X, width) at the non-decreasing query times query_times[0], ..., query_times[*m - 1],
+//    which do not need to coincide with observation times, so that no resampled time series needs to be created
+// -) the query times and observation times are merged in a single pass, i.e. the rolling time window moves forward
+//    from one query time to the next. 'roll_area' is the area under the sample path between times[left] and
+//    times[right], with a negative sign if left > right, i.e. if the time window contains no observation.
+// -) the sample path is constant before the first and after the last observation
+
+
+// SMA_last(X, width) at query times
+void sma_last_query_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after, const double query_times[], const ptrdiff_t *m)
+{
+  // values       ... array of time series values
+  // times        ... array of observation times
+  // n            ... number of observations, i.e. length of 'values' and 'times'
+  // values_new   ... array of length *m to store output time series values
+  // width_before ... (non-negative) width of rolling window before query time
+  // width_after  ... (non-negative) width of rolling window after query time
+  // query_times  ... array of non-decreasing query times
+  // m            ... number of query times, i.e. length of 'query_times'
+  
+  ptrdiff_t left = 0, right = 0;
+  double t_left_new, t_right_new, roll_area = 0, left_area, right_area;
+  
+  // Trivial case
+  if (*n == 0)
+    return;
+  
+  // Apply rolling window
+  for (ptrdiff_t q = 0; q < *m; q++) {
+    // Expand interval on right end
+    t_right_new = query_times[q] + *width_after;
+    while ((right < *n - 1) && (times[right + 1] <= t_right_new)) {
+      right++;
+      roll_area += values[right - 1] * (times[right] - times[right - 1]);
+    }
+    
+    // Shrink interval on left end
+    t_left_new = query_times[q] - *width_before;
+    while ((left < *n - 1) && (times[left] < t_left_new)) {
+      roll_area -= values[left] * (times[left+1] - times[left]);
+      left++;
+    }
+    
+    // Truncated area on left and right end
+    left_area = values[times[left] < t_left_new ? left : MAX(0, left-1)] * (times[left] - t_left_new);
+    right_area = values[right] * (t_right_new - times[right]);
     
     // Save SMA value for current time window
-    values_new[i] = roll_area / (*width_before + *width_after);
+    values_new[q] = (roll_area + left_area + right_area) / (*width_before + *width_after);
   }
+  INSTRUMENT_WINDOW(right, left);
+}
+
+
+// SMA_next(X, width) at query times
+void sma_next_query_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after, const double query_times[], const ptrdiff_t *m)
+{
+  // values       ... array of time series values
+  // times        ... array of observation times
+  // n            ... number of observations, i.e. length of 'values' and 'times'
+  // values_new   ... array of length *m to store output time series values
+  // width_before ... (non-negative) width of rolling window before query time
+  // width_after  ... (non-negative) width of rolling window after query time
+  // query_times  ... array of non-decreasing query times
+  // m            ... number of query times, i.e. length of 'query_times'
+  
+  ptrdiff_t left = 0, right = 0;
+  double t_left_new, t_right_new, roll_area = 0, left_area, right_area;
+  
+  // Trivial case
+  if (*n == 0)
+    return;
+  
+  // Apply rolling window
+  for (ptrdiff_t q = 0; q < *m; q++) {
+    // Expand interval on right end
+    t_right_new = query_times[q] + *width_after;
+    while ((right < *n - 1) && (times[right + 1] <= t_right_new)) {
+      right++;
+      roll_area += values[right] * (times[right] - times[right - 1]);
+    }
+    
+    // Shrink interval on left end
+    t_left_new = query_times[q] - *width_before;
+    while ((left < *n - 1) && (times[left] < t_left_new)) {
+      roll_area -= values[left+1] * (times[left+1] - times[left]);
+      left++;
+    }
+    
+    // Truncated area on left and right end
+    left_area = values[left] * (times[left] - t_left_new);
+    right_area = values[times[right] < t_right_new ? MIN(right+1, *n-1) : right] * (t_right_new - times[right]);
+    
+    // Save SMA value for current time window
+    values_new[q] = (roll_area + left_area + right_area) / (*width_before + *width_after);
+  }
+  INSTRUMENT_WINDOW(right, left);
+}
+
+
+// SMA_linear(X, width) at query times
+void sma_linear_query_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after, const double query_times[], const ptrdiff_t *m)
+{
+  // values       ... array of time series values
+  // times        ... array of observation times
+  // n            ... number of observations, i.e. length of 'values' and 'times'
+  // values_new   ... array of length *m to store output time series values
+  // width_before ... (non-negative) width of rolling window before query time
+  // width_after  ... (non-negative) width of rolling window after query time
+  // query_times  ... array of non-decreasing query times
+  // m            ... number of query times, i.e. length of 'query_times'
+  
+  ptrdiff_t left = 0, right = 0;
+  double t_left_new, t_right_new, roll_area = 0, left_area, right_area;
+  
+  // Trivial case
+  if (*n == 0)
+    return;
+  
+  // Apply rolling window
+  for (ptrdiff_t q = 0; q < *m; q++) {
+    // Expand interval on right end
+    t_right_new = query_times[q] + *width_after;
+    while ((right < *n - 1) && (times[right + 1] <= t_right_new)) {
+      right++;
+      roll_area += (values[right] + values[right - 1]) / 2 * (times[right] - times[right - 1]);
+    }
+    
+    // Shrink interval on left end
+    t_left_new = query_times[q] - *width_before;
+    while ((left < *n - 1) && (times[left] < t_left_new)) {
+      roll_area -= (values[left] + values[left+1]) / 2 * (times[left+1] - times[left]);
+      left++;
+    }
+    
+    // Truncated area on left and right end, where the window may end after the last or before the first observation
+    if (times[left] < t_left_new)
+      left_area = values[left] * (times[left] - t_left_new);
+    else
+      left_area = trapezoid_left(times[MAX(0, left-1)], t_left_new, times[left], values[MAX(0, left-1)],
+        values[left]);
+    if (t_right_new < times[right])
+      right_area = values[right] * (t_right_new - times[right]);
+    else
+      right_area = trapezoid_right(times[right], t_right_new, times[MIN(right+1, *n-1)], values[right],
+        values[MIN(right+1, *n-1)]);
+    
+    // Save SMA value for current time window
+    values_new[q] = (roll_area + left_area + right_area) / (*width_before + *width_after);
+  }
+  INSTRUMENT_WINDOW(right, left);
+}
+
+
+
+/************ Versions with 32-bit lengths ************/
+
+void sma_last(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after)
+{
+  ptrdiff_t n_long = *n;
+  sma_last_long(values, times, &n_long, values_new, width_before, width_after);
+}
+
+
+void sma_next(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after)
+{
+  ptrdiff_t n_long = *n;
+  sma_next_long(values, times, &n_long, values_new, width_before, width_after);
+}
+
+
+void sma_linear(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after)
+{
+  ptrdiff_t n_long = *n;
+  sma_linear_long(values, times, &n_long, values_new, width_before, width_after);
+}
+
+
+void sma_last_batch(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_cols)
+{
+  ptrdiff_t n_long = *n;
+  sma_last_batch_long(values, times, &n_long, values_new, width_before, width_after, num_cols);
+}
+
+
+void sma_next_batch(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_cols)
+{
+  ptrdiff_t n_long = *n;
+  sma_next_batch_long(values, times, &n_long, values_new, width_before, width_after, num_cols);
+}
+
+
+void sma_linear_batch(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_cols)
+{
+  ptrdiff_t n_long = *n;
+  sma_linear_batch_long(values, times, &n_long, values_new, width_before, width_after, num_cols);
+}
+
+
+void sma_last_parallel(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_threads, const int *min_chunk)
+{
+  ptrdiff_t n_long = *n;
+  sma_last_parallel_long(values, times, &n_long, values_new, width_before, width_after, num_threads, min_chunk);
+}
+
+
+void sma_next_parallel(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_threads, const int *min_chunk)
+{
+  ptrdiff_t n_long = *n;
+  sma_next_parallel_long(values, times, &n_long, values_new, width_before, width_after, num_threads, min_chunk);
+}
+
+
+void sma_linear_parallel(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_threads, const int *min_chunk)
+{
+  ptrdiff_t n_long = *n;
+  sma_linear_parallel_long(values, times, &n_long, values_new, width_before, width_after, num_threads, min_chunk);
+}
+
+
+void sma_last_query(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after, const double query_times[], const int *m)
+{
+  ptrdiff_t n_long = *n, m_long = *m;
+  sma_last_query_long(values, times, &n_long, values_new, width_before, width_after, query_times, &m_long);
+}
+
+
+void sma_next_query(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after, const double query_times[], const int *m)
+{
+  ptrdiff_t n_long = *n, m_long = *m;
+  sma_next_query_long(values, times, &n_long, values_new, width_before, width_after, query_times, &m_long);
+}
+
+
+void sma_linear_query(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after, const double query_times[], const int *m)
+{
+  ptrdiff_t n_long = *n, m_long = *m;
+  sma_linear_query_long(values, times, &n_long, values_new, width_before, width_after, query_times, &m_long);
 }
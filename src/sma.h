@@ -1,10 +1,64 @@
 // Copyright: 2012-2018 by Andreas Eckner
 // License: GPL-2 | GPL-3
-// Remark: To facilitate interfaces to other programming languages such as R, all variables are either pointers or arrays
+// Remark: To facilitate interfaces to other programming languages such as R, all variables are either pointers or arrays.
+//         The number of observations has type ptrdiff_t to support long vectors (more than 2^31 - 1 elements) in R,
+//         and the functions without suffix "_long" are thin wrappers for callers with 32-bit lengths.
 
 #ifndef _sma_h
 #define _sma_h
 
+#include <stddef.h>
+
+void sma_last_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after);
+
+void sma_next_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after);
+
+void sma_linear_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after);
+
+// Batch versions for several time series with identical observation times, stored in row-major order
+void sma_last_batch_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_cols);
+
+void sma_next_batch_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_cols);
+
+void sma_linear_batch_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_cols);
+
+// Multi-threaded versions, where the output positions are split into chunks of at least *min_chunk positions
+void sma_last_parallel_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_threads, const int *min_chunk);
+
+void sma_next_parallel_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_threads, const int *min_chunk);
+
+void sma_linear_parallel_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_threads, const int *min_chunk);
+
+// Versions with output at arbitrary non-decreasing query times, output stored in array of length *m
+void sma_last_query_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after, const double query_times[], const ptrdiff_t *m);
+
+void sma_next_query_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after, const double query_times[], const ptrdiff_t *m);
+
+void sma_linear_query_long(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after, const double query_times[], const ptrdiff_t *m);
+
+// Single-precision versions with float observation values and output values, but double observation times
+void sma_last_float_long(const float values[], const double times[], const ptrdiff_t *n, float values_new[],
+  const double *width_before, const double *width_after);
+
+void sma_next_float_long(const float values[], const double times[], const ptrdiff_t *n, float values_new[],
+  const double *width_before, const double *width_after);
+
+void sma_linear_float_long(const float values[], const double times[], const ptrdiff_t *n, float values_new[],
+  const double *width_before, const double *width_after);
+
+// Versions with 32-bit lengths
 void sma_last(const double values[], const double times[], const int *n, double values_new[],
   const double *width_before, const double *width_after);
 
@@ -14,4 +68,31 @@ void sma_next(const double values[], const double times[], const int *n, double
 void sma_linear(const double values[], const double times[], const int *n, double values_new[],
   const double *width_before, const double *width_after);
 
+void sma_last_batch(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_cols);
+
+void sma_next_batch(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_cols);
+
+void sma_linear_batch(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_cols);
+
+void sma_last_parallel(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_threads, const int *min_chunk);
+
+void sma_next_parallel(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_threads, const int *min_chunk);
+
+void sma_linear_parallel(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after, const int *num_threads, const int *min_chunk);
+
+void sma_last_query(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after, const double query_times[], const int *m);
+
+void sma_next_query(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after, const double query_times[], const int *m);
+
+void sma_linear_query(const double values[], const double times[], const int *n, double values_new[],
+  const double *width_before, const double *width_after, const double query_times[], const int *m);
+
 #endif
@@ -10,11 +10,11 @@ Rcpp::NumericVector Rcpp_wrapper_sma_last(const Rcpp::NumericVector& values, con
   double width_before, double width_after)
 {
   // Allocate memory for output
-  int n = values.size();
+  ptrdiff_t n = values.size();
   Rcpp::NumericVector res(n);
   
   // Call C function
-  sma_last(values.begin(), times.begin(), &n, res.begin(), &width_before, &width_after);
+  sma_last_long(values.begin(), times.begin(), &n, res.begin(), &width_before, &width_after);
   return res;
 }
 
@@ -24,11 +24,11 @@ Rcpp::NumericVector Rcpp_wrapper_sma_linear(const Rcpp::NumericVector& values, c
   double width_before, double width_after)
 {
   // Allocate memory for output
-  int n = values.size();
+  ptrdiff_t n = values.size();
   Rcpp::NumericVector res(n);
   
   // Call C function
-  sma_linear(values.begin(), times.begin(), &n, res.begin(), &width_before, &width_after);
+  sma_linear_long(values.begin(), times.begin(), &n, res.begin(), &width_before, &width_after);
   return res;
 }
 
@@ -38,10 +38,154 @@ Rcpp::NumericVector Rcpp_wrapper_sma_next(const Rcpp::NumericVector& values, con
   double width_before, double width_after)
 {
   // Allocate memory for output
-  int n = values.size();
+  ptrdiff_t n = values.size();
   Rcpp::NumericVector res(n);
   
   // Call C function
-  sma_next(values.begin(), times.begin(), &n, res.begin(), &width_before, &width_after);
+  sma_next_long(values.begin(), times.begin(), &n, res.begin(), &width_before, &width_after);
+  return res;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::NumericMatrix Rcpp_wrapper_sma_last_batch(const Rcpp::NumericMatrix& values, const Rcpp::DatetimeVector& times,
+  double width_before, double width_after)
+{
+  // Allocate memory for output
+  ptrdiff_t n = values.ncol();
+  int num_cols = values.nrow();
+  Rcpp::NumericMatrix res(num_cols, n);
+  if (times.size() != n)
+    Rcpp::stop("The number of columns of 'values' and the length of 'times' need to match");
+  
+  // Call C function
+  sma_last_batch_long(values.begin(), times.begin(), &n, res.begin(), &width_before, &width_after, &num_cols);
+  return res;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::NumericMatrix Rcpp_wrapper_sma_linear_batch(const Rcpp::NumericMatrix& values, const Rcpp::DatetimeVector& times,
+  double width_before, double width_after)
+{
+  // Allocate memory for output
+  ptrdiff_t n = values.ncol();
+  int num_cols = values.nrow();
+  Rcpp::NumericMatrix res(num_cols, n);
+  if (times.size() != n)
+    Rcpp::stop("The number of columns of 'values' and the length of 'times' need to match");
+  
+  // Call C function
+  sma_linear_batch_long(values.begin(), times.begin(), &n, res.begin(), &width_before, &width_after, &num_cols);
+  return res;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::NumericMatrix Rcpp_wrapper_sma_next_batch(const Rcpp::NumericMatrix& values, const Rcpp::DatetimeVector& times,
+  double width_before, double width_after)
+{
+  // Allocate memory for output
+  ptrdiff_t n = values.ncol();
+  int num_cols = values.nrow();
+  Rcpp::NumericMatrix res(num_cols, n);
+  if (times.size() != n)
+    Rcpp::stop("The number of columns of 'values' and the length of 'times' need to match");
+  
+  // Call C function
+  sma_next_batch_long(values.begin(), times.begin(), &n, res.begin(), &width_before, &width_after, &num_cols);
+  return res;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::NumericVector Rcpp_wrapper_sma_last_parallel(const Rcpp::NumericVector& values, const Rcpp::DatetimeVector& times,
+  double width_before, double width_after, int num_threads, int min_chunk)
+{
+  // Allocate memory for output
+  ptrdiff_t n = values.size();
+  Rcpp::NumericVector res(n);
+  
+  // Call C function
+  sma_last_parallel_long(values.begin(), times.begin(), &n, res.begin(), &width_before, &width_after, &num_threads,
+    &min_chunk);
+  return res;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::NumericVector Rcpp_wrapper_sma_linear_parallel(const Rcpp::NumericVector& values, const Rcpp::DatetimeVector& times,
+  double width_before, double width_after, int num_threads, int min_chunk)
+{
+  // Allocate memory for output
+  ptrdiff_t n = values.size();
+  Rcpp::NumericVector res(n);
+  
+  // Call C function
+  sma_linear_parallel_long(values.begin(), times.begin(), &n, res.begin(), &width_before, &width_after, &num_threads,
+    &min_chunk);
+  return res;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::NumericVector Rcpp_wrapper_sma_next_parallel(const Rcpp::NumericVector& values, const Rcpp::DatetimeVector& times,
+  double width_before, double width_after, int num_threads, int min_chunk)
+{
+  // Allocate memory for output
+  ptrdiff_t n = values.size();
+  Rcpp::NumericVector res(n);
+  
+  // Call C function
+  sma_next_parallel_long(values.begin(), times.begin(), &n, res.begin(), &width_before, &width_after, &num_threads,
+    &min_chunk);
+  return res;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::NumericVector Rcpp_wrapper_sma_last_query(const Rcpp::NumericVector& values, const Rcpp::DatetimeVector& times,
+  double width_before, double width_after, const Rcpp::DatetimeVector& query_times)
+{
+  // Allocate memory for output
+  ptrdiff_t n = values.size();
+  ptrdiff_t m = query_times.size();
+  Rcpp::NumericVector res(m);
+  
+  // Call C function
+  sma_last_query_long(values.begin(), times.begin(), &n, res.begin(), &width_before, &width_after, query_times.begin(),
+    &m);
+  return res;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::NumericVector Rcpp_wrapper_sma_linear_query(const Rcpp::NumericVector& values, const Rcpp::DatetimeVector& times,
+  double width_before, double width_after, const Rcpp::DatetimeVector& query_times)
+{
+  // Allocate memory for output
+  ptrdiff_t n = values.size();
+  ptrdiff_t m = query_times.size();
+  Rcpp::NumericVector res(m);
+  
+  // Call C function
+  sma_linear_query_long(values.begin(), times.begin(), &n, res.begin(), &width_before, &width_after, query_times.begin(),
+    &m);
+  return res;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::NumericVector Rcpp_wrapper_sma_next_query(const Rcpp::NumericVector& values, const Rcpp::DatetimeVector& times,
+  double width_before, double width_after, const Rcpp::DatetimeVector& query_times)
+{
+  // Allocate memory for output
+  ptrdiff_t n = values.size();
+  ptrdiff_t m = query_times.size();
+  Rcpp::NumericVector res(m);
+  
+  // Call C function
+  sma_next_query_long(values.begin(), times.begin(), &n, res.begin(), &width_before, &width_after, query_times.begin(),
+    &m);
   return res;
 }
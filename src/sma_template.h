@@ -0,0 +1,256 @@
+// Copyright: 2012-2018 by Andreas Eckner
+// License: GPL-2 | GPL-3
+// Remark: Simple moving averages for a generic type of observation values, i.e. a template in C. This file is included
+//         by sma.c once for each value type, after defining the following macros:
+//         -) VALUE_TYPE ... type of the observation values and output values (double or float)
+//         -) KERNEL_NAME(name) ... name of the public function for the value type, e.g. sma_last_float_long
+//         -) RANGE_NAME(name) ... name of the static function for a range of output positions
+//         The rolling area, and the sum of adjacent observation values for SMA_linear, are always calculated in
+//         double precision.
+//         There is deliberately no include guard.
+
+
+// SMA_last(X, width) for output positions start, ..., end - 1
+static void RANGE_NAME(sma_last)(const VALUE_TYPE values[], const double times[], const ptrdiff_t *n,
+  VALUE_TYPE values_new[], const double *width_before, const double *width_after, ptrdiff_t start, ptrdiff_t end)
+{
+  // values       ... array of time series values
+  // times        ... array of observation times
+  // n            ... number of observations, i.e. length of 'values' and 'times'
+  // values_new   ... array of length *n to store output time series values
+  // width_before ... (non-negative) width of rolling window before t_i
+  // width_after  ... (non-negative) width of rolling window after t_i
+  // start        ... first output position
+  // end          ... one past the last output position
+  
+  ptrdiff_t left = 0, right = 0;
+  double t_left_new, t_right_new, roll_area, left_area, right_area = 0;
+  
+  // Trivial case
+  if (start >= end)
+    return;
+  
+  if ((start == 0) && (*width_after == 0)) {
+    // The causal rolling time window of the first observation only covers the constant sample path before it
+    values_new[0] = values[0];
+    roll_area = left_area = values[0] * *width_before;
+    start = 1;
+  } else {
+    // Determine left end of rolling time window for first output position by binary search (see apply_range_kernel),
+    // and start with an empty window, which is then expanded on the right end in the first iteration
+    left = right = first_index_at_or_after(times, *n, times[start] - *width_before);
+    roll_area = left_area = 0;
+  }
+  
+  // Only count the window steps for output positions start, ..., end - 1
+  INSTRUMENT_WINDOW(-right, -left);
+  
+  // Apply rolling window
+  for (ptrdiff_t i = start; i < end; i++) {
+    // Remove truncated area on left and right end
+    roll_area -= (left_area + right_area);
+    
+    // Expand interval on right end
+    t_right_new = times[i] + *width_after;
+    while ((right < *n - 1) && (times[right + 1] <= t_right_new)) {
+      right++;
+      roll_area += values[right - 1] * (times[right] - times[right - 1]);
+    }
+    
+    // Shrink interval on left end
+    t_left_new = times[i] - *width_before;
+    while (times[left] < t_left_new) {
+      roll_area -= values[left] * (times[left+1] - times[left]);
+      left++;  
+    }
+    
+    // Add truncated area on left and right end
+    left_area = values[MAX(0, left-1)] * (times[left] - t_left_new);
+    right_area = values[right] * (t_right_new - times[right]);
+    roll_area += left_area + right_area;
+    
+    // Save SMA value for current time window
+    values_new[i] = roll_area / (*width_before + *width_after);
+  }
+  INSTRUMENT_WINDOW(right, left);
+}
+
+
+// SMA_last(X, width)
+void KERNEL_NAME(sma_last)(const VALUE_TYPE values[], const double times[], const ptrdiff_t *n,
+  VALUE_TYPE values_new[], const double *width_before, const double *width_after)
+{
+  // values       ... array of time series values
+  // times        ... array of observation times
+  // n            ... number of observations, i.e. length of 'values' and 'times'
+  // values_new   ... array of length *n to store output time series values
+  // width_before ... (non-negative) width of rolling window before t_i
+  // width_after  ... (non-negative) width of rolling window after t_i
+  
+  RANGE_NAME(sma_last)(values, times, n, values_new, width_before, width_after, 0, *n);
+}
+
+
+// SMA_next(X, width) for output positions start, ..., end - 1
+static void RANGE_NAME(sma_next)(const VALUE_TYPE values[], const double times[], const ptrdiff_t *n,
+  VALUE_TYPE values_new[], const double *width_before, const double *width_after, ptrdiff_t start, ptrdiff_t end)
+{
+  // values       ... array of time series values
+  // times        ... array of observation times
+  // n            ... number of observations, i.e. length of 'values' and 'times'
+  // values_new   ... array of length *n to store output time series values
+  // width_before ... (non-negative) width of rolling window before t_i
+  // width_after  ... (non-negative) width of rolling window after t_i
+  // start        ... first output position
+  // end          ... one past the last output position
+  
+  ptrdiff_t left = 0, right = 0;
+  double t_left_new, t_right_new, roll_area, left_area, right_area = 0;
+  
+  // Trivial case
+  if (start >= end)
+    return;
+  
+  if ((start == 0) && (*width_after == 0)) {
+    // The causal rolling time window of the first observation only covers the constant sample path before it
+    values_new[0] = values[0];
+    roll_area = left_area = values[0] * *width_before;
+    start = 1;
+  } else {
+    // Determine left end of rolling time window for first output position by binary search (see apply_range_kernel),
+    // and start with an empty window, which is then expanded on the right end in the first iteration
+    left = right = first_index_at_or_after(times, *n, times[start] - *width_before);
+    roll_area = left_area = 0;
+  }
+  
+  // Only count the window steps for output positions start, ..., end - 1
+  INSTRUMENT_WINDOW(-right, -left);
+  
+  // Apply rolling window
+  for (ptrdiff_t i = start; i < end; i++) {
+    // Remove truncated area on left and right end
+    roll_area -= (left_area + right_area);
+    
+    // Expand interval on right end
+    t_right_new = times[i] + *width_after;
+    while ((right < *n - 1) && (times[right + 1] <= t_right_new)) {
+      right++;
+      roll_area += values[right] * (times[right] - times[right - 1]);
+    }
+    
+    // Shrink interval on left end
+    t_left_new = times[i] - *width_before;
+    while (times[left] < t_left_new) {
+      roll_area -= values[left+1] * (times[left+1] - times[left]);
+      left++;  
+    }
+    
+    // Add truncated area on left and right end
+    left_area = values[left] * (times[left] - t_left_new);
+    right_area = values[MIN(right+1, *n-1)] * (t_right_new - times[right]);
+    roll_area += left_area + right_area;
+    
+    // Save SMA value for current time window
+    values_new[i] = roll_area / (*width_before + *width_after);
+  }
+  INSTRUMENT_WINDOW(right, left);
+}
+
+
+// SMA_next(X, width)
+void KERNEL_NAME(sma_next)(const VALUE_TYPE values[], const double times[], const ptrdiff_t *n,
+  VALUE_TYPE values_new[], const double *width_before, const double *width_after)
+{
+  // values       ... array of time series values
+  // times        ... array of observation times
+  // n            ... number of observations, i.e. length of 'values' and 'times'
+  // values_new   ... array of length *n to store output time series values
+  // width_before ... (non-negative) width of rolling window before t_i
+  // width_after  ... (non-negative) width of rolling window after t_i
+  
+  RANGE_NAME(sma_next)(values, times, n, values_new, width_before, width_after, 0, *n);
+}
+
+
+// SMA_linear(X, width) for output positions start, ..., end - 1
+static void RANGE_NAME(sma_linear)(const VALUE_TYPE values[], const double times[], const ptrdiff_t *n,
+  VALUE_TYPE values_new[], const double *width_before, const double *width_after, ptrdiff_t start, ptrdiff_t end)
+{
+  // values       ... array of time series values
+  // times        ... array of observation times
+  // n            ... number of observations, i.e. length of 'values' and 'times'
+  // values_new   ... array of length *n to store output time series values
+  // width_before ... (non-negative) width of rolling window before t_i
+  // width_after  ... (non-negative) width of rolling window after t_i
+  // start        ... first output position
+  // end          ... one past the last output position
+  
+  ptrdiff_t left = 0, right = 0;
+  double t_left_new, t_right_new, roll_area, left_area, right_area = 0;
+  
+  // Trivial case
+  if (start >= end)
+    return;
+  
+  if ((start == 0) && (*width_after == 0)) {
+    // The causal rolling time window of the first observation only covers the constant sample path before it
+    values_new[0] = values[0];
+    roll_area = left_area = values[0] * *width_before;
+    start = 1;
+  } else {
+    // Determine left end of rolling time window for first output position by binary search (see apply_range_kernel),
+    // and start with an empty window, which is then expanded on the right end in the first iteration
+    left = right = first_index_at_or_after(times, *n, times[start] - *width_before);
+    roll_area = left_area = 0;
+  }
+  
+  // Only count the window steps for output positions start, ..., end - 1
+  INSTRUMENT_WINDOW(-right, -left);
+  
+  // Apply rolling window
+  for (ptrdiff_t i = start; i < end; i++) {   
+    // Remove truncated area on left and right end
+    roll_area -= (left_area + right_area);
+    
+    // Expand interval on right end
+    t_right_new = times[i] + *width_after;
+    while ((right < *n - 1) && (times[right + 1] <= t_right_new)) {
+      right++;
+      roll_area += ((double) values[right] + values[right - 1])/2 * (times[right] - times[right - 1]);
+    }
+    
+    // Shrink interval on left end
+    t_left_new = times[i] - *width_before;
+    while (times[left] < t_left_new) {
+      roll_area -= ((double) values[left] + values[left+1]) / 2 *
+        (times[left+1] - times[left]);
+      left++;  
+    }
+    
+    // Add truncated area on left and right end
+    left_area = trapezoid_left(times[MAX(0, left-1)], t_left_new, times[left],
+      values[MAX(0, left-1)], values[left]);
+    right_area = trapezoid_right(times[right], t_right_new, times[MIN(right+1, *n-1)],
+      values[right], values[MIN(right+1, *n-1)]);
+    roll_area += left_area + right_area;
+    
+    // Save SMA value for current time window
+    values_new[i] = roll_area / (*width_before + *width_after);
+  }
+  INSTRUMENT_WINDOW(right, left);
+}
+
+
+// SMA_linear(X, width)
+void KERNEL_NAME(sma_linear)(const VALUE_TYPE values[], const double times[], const ptrdiff_t *n,
+  VALUE_TYPE values_new[], const double *width_before, const double *width_after)
+{
+  // values       ... array of time series values
+  // times        ... array of observation times
+  // n            ... number of observations, i.e. length of 'values' and 'times'
+  // values_new   ... array of length *n to store output time series values
+  // width_before ... (non-negative) width of rolling window before t_i
+  // width_after  ... (non-negative) width of rolling window after t_i
+  
+  RANGE_NAME(sma_linear)(values, times, n, values_new, width_before, width_after, 0, *n);
+}
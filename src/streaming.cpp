@@ -0,0 +1,498 @@
+// Copyright: 2012-2018 by Andreas Eckner
+// License: GPL-2 | GPL-3
+
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include "streaming.h"
+#include "trapezoid.h"
+
+// Checkpoint header
+#define STREAMING_MAGIC 0x4F535455u     // "UTSO" in little-endian byte order
+#define STREAMING_VERSION 1u
+
+
+// Format a description such as "EMA_last(tau=3600s)"
+static std::string format_description(const std::string& name, const std::string& arg_name, double arg)
+{
+  std::ostringstream out;
+  out.precision(15);
+  out << name << "(" << arg_name << "=" << arg << "s)";
+  return out.str();
+}
+
+
+// Throw an error for an invalid checkpoint, unless the condition holds
+static inline void check_state(bool condition)
+{
+  if (!condition)
+    throw std::invalid_argument("Corrupt streaming operator state");
+}
+
+
+/****************** StreamingOperator ******************/
+
+// Check that an observation can be pushed after an observation at time 'time_prev' (if 'has_prev' is true)
+static void check_observation(double time, double value, bool has_prev, double time_prev)
+{
+  if (!std::isfinite(time) || !std::isfinite(value))
+    throw std::invalid_argument("The observation time and value have to be finite and not NA");
+  if (has_prev && !(time > time_prev))
+    throw std::invalid_argument("The observation times need to be strictly increasing");
+}
+
+
+double StreamingOperator::push(double time, double value)
+{
+  // time  ... observation time (needs to be larger than all previous observation times)
+  // value ... observation value
+
+  check_observation(time, value, num_obs > 0, time_last);
+  double out = update(time, value);
+  time_last = time;
+  num_obs++;
+  return out;
+}
+
+
+void StreamingOperator::push(const double times[], const double values[], double values_new[], std::size_t n)
+{
+  // times      ... observation times (need to be strictly increasing and larger than all previous observation times)
+  // values     ... observation values
+  // values_new ... array of length n to store output values
+  // n          ... number of observations
+
+  // Check all observations before the first state update
+  for (std::size_t i = 0; i < n; i++)
+    check_observation(times[i], values[i], (i > 0) || (num_obs > 0), (i > 0) ? times[i - 1] : time_last);
+
+  for (std::size_t i = 0; i < n; i++)
+    values_new[i] = push(times[i], values[i]);
+}
+
+
+std::vector<unsigned char> StreamingOperator::save() const
+{
+  StateWriter out;
+
+  // Header, followed by the state common to all operators
+  out.put_uint32(STREAMING_MAGIC);
+  out.put_uint32(STREAMING_VERSION);
+  out.put_uint32(type());
+  out.put_uint64(num_obs);
+  out.put_double(time_last);
+
+  // Operator-specific state
+  save_state(out);
+  return out.bytes;
+}
+
+
+StreamingOperator* StreamingOperator::restore(const unsigned char data[], std::size_t size)
+{
+  // data ... checkpoint created by save()
+  // size ... number of bytes in checkpoint
+
+  // Check header
+  StateReader in(data, size);
+  if (in.get_uint32() != STREAMING_MAGIC)
+    throw std::invalid_argument("Not a streaming operator checkpoint");
+  if (in.get_uint32() != STREAMING_VERSION)
+    throw std::invalid_argument("Unsupported streaming operator checkpoint version");
+
+  // Create operator with placeholder parameters, which are overwritten when restoring the state
+  StreamingOperator *op;
+  switch (in.get_uint32()) {
+    case EMA: op = new StreamingEma(1, StreamingEma::LAST); break;
+    case SMA: op = new StreamingSma(1, StreamingSma::LAST); break;
+    case ROLLING_SUM: op = new StreamingRollingSum(1, StreamingRollingSum::SUM); break;
+    case ROLLING_MIN_MAX: op = new StreamingRollingMinMax(1, true); break;
+    case ROLLING_MEDIAN: op = new StreamingRollingMedian(1); break;
+    default: throw std::invalid_argument("Unknown streaming operator type");
+  }
+
+  // Restore state
+  try {
+    uint64_t num_obs = in.get_uint64();
+    check_state(num_obs < (1ull << 62));
+    op->num_obs = num_obs;
+    op->time_last = in.get_double();
+    check_state(std::isfinite(op->time_last));
+    op->restore_state(in);
+    check_state(in.at_end());
+  } catch (...) {
+    delete op;
+    throw;
+  }
+  return op;
+}
+
+
+
+/****************** StreamingEma ******************/
+
+StreamingEma::StreamingEma(double tau, Interpolation interpolation) :
+  tau(tau), interpolation(interpolation), value_last(0), ema(0)
+{
+  if (!(tau > 0) || !std::isfinite(tau))
+    throw std::invalid_argument("The EMA half-life has to be positive and finite");
+}
+
+
+double StreamingEma::update(double time, double value)
+{
+  // time  ... observation time
+  // value ... observation value
+
+  double w, w2, tmp;
+
+  // Same order of floating-point operations as ema_last(), ema_next() and ema_linear()
+  if (num_obs == 0)
+    ema = value;
+  else if (interpolation == LINEAR) {
+    tmp = (time - time_last) / tau;
+    w = exp(-tmp);
+    if (tmp > 1e-6)
+      w2 = (1 - w) / tmp;
+    else {
+      // Use Taylor expansion for numerical stability
+      w2 = 1 - tmp/2 + tmp*tmp/6 - tmp*tmp*tmp/24;
+    }
+    ema = ema * w + value * (1 - w2) + value_last * (w2 - w);
+  } else {
+    w = exp(-(time - time_last) / tau);
+    ema = ema * w + (interpolation == NEXT ? value : value_last) * (1-w);
+  }
+  value_last = value;
+  return ema;
+}
+
+
+std::string StreamingEma::description() const
+{
+  const char *names[] = {"EMA_last", "EMA_next", "EMA_linear"};
+  return format_description(names[interpolation], "tau", tau);
+}
+
+
+void StreamingEma::save_state(StateWriter& out) const
+{
+  out.put_double(tau);
+  out.put_uint32(interpolation);
+  out.put_double(value_last);
+  out.put_double(ema);
+}
+
+
+void StreamingEma::restore_state(StateReader& in)
+{
+  tau = in.get_double();
+  uint32_t method = in.get_uint32();
+  value_last = in.get_double();
+  ema = in.get_double();
+  check_state((tau > 0) && std::isfinite(tau) && (method <= LINEAR));
+  interpolation = (Interpolation) method;
+}
+
+
+
+/****************** StreamingSma ******************/
+
+StreamingSma::StreamingSma(double width, Interpolation interpolation) :
+  width(width), interpolation(interpolation), left(0), window_start(0), roll_area(0), left_area(0), right_area(0)
+{
+  if (!(width > 0) || !std::isfinite(width))
+    throw std::invalid_argument("The rolling window width has to be positive and finite");
+}
+
+
+double StreamingSma::update(double time, double value)
+{
+  // time  ... observation time
+  // value ... observation value
+
+  // Same order of floating-point operations as sma_last(), sma_next() and sma_linear() with width_after=0
+  long long right = num_obs;
+  window.push_back(Observation {time, value});
+
+  // Initialize output
+  if (num_obs == 0) {
+    roll_area = left_area = value * width;
+    return value;
+  }
+
+  // Remove truncated area on left and right end
+  roll_area -= (left_area + right_area);
+
+  // Expand interval on right end
+  const Observation &prev = obs(right - 1);
+  if (interpolation == LAST)
+    roll_area += prev.value * (time - prev.time);
+  else if (interpolation == NEXT)
+    roll_area += value * (time - prev.time);
+  else
+    roll_area += (value + prev.value)/2 * (time - prev.time);
+
+  // Shrink interval on left end
+  double t_left_new = time - width;
+  while (obs(left).time < t_left_new) {
+    const Observation &obs_left = obs(left), &obs_next = obs(left + 1);
+    if (interpolation == LAST)
+      roll_area -= obs_left.value * (obs_next.time - obs_left.time);
+    else if (interpolation == NEXT)
+      roll_area -= obs_next.value * (obs_next.time - obs_left.time);
+    else
+      roll_area -= (obs_left.value + obs_next.value) / 2 * (obs_next.time - obs_left.time);
+    left++;
+  }
+
+  // Add truncated area on left and right end
+  // -) the right end of the rolling window coincides with the last observation time, so there is no truncated area on
+  //    the right end
+  const Observation &obs_left = obs(left), &obs_before = obs(left > 0 ? left - 1 : 0);
+  if (interpolation == LAST)
+    left_area = obs_before.value * (obs_left.time - t_left_new);
+  else if (interpolation == NEXT)
+    left_area = obs_left.value * (obs_left.time - t_left_new);
+  else
+    left_area = trapezoid_left(obs_before.time, t_left_new, obs_left.time, obs_before.value, obs_left.value);
+  right_area = 0;
+  roll_area += left_area + right_area;
+
+  // Drop observations that are no longer needed
+  while (window_start < left - 1) {
+    window.pop_front();
+    window_start++;
+  }
+
+  return roll_area / width;
+}
+
+
+std::string StreamingSma::description() const
+{
+  const char *names[] = {"SMA_last", "SMA_next", "SMA_linear"};
+  return format_description(names[interpolation], "width", width);
+}
+
+
+void StreamingSma::save_state(StateWriter& out) const
+{
+  out.put_double(width);
+  out.put_uint32(interpolation);
+  out.put_uint64(left);
+  out.put_uint64(window_start);
+  out.put_double(roll_area);
+  out.put_double(left_area);
+  out.put_double(right_area);
+  out.put_window(window);
+}
+
+
+void StreamingSma::restore_state(StateReader& in)
+{
+  width = in.get_double();
+  uint32_t method = in.get_uint32();
+  left = in.get_uint64();
+  window_start = in.get_uint64();
+  roll_area = in.get_double();
+  left_area = in.get_double();
+  right_area = in.get_double();
+  in.get_window(window);
+
+  // The buffer needs to hold the observations left - 1 (if it exists), ..., num_obs - 1
+  check_state((width > 0) && std::isfinite(width) && (method <= LINEAR));
+  check_state((window_start >= 0) && (window_start + (long long) window.size() == num_obs));
+  check_state((num_obs == 0) || ((left >= window_start) && (left <= window_start + 1) && (left < num_obs)));
+  interpolation = (Interpolation) method;
+}
+
+
+
+/****************** StreamingRollingSum ******************/
+
+StreamingRollingSum::StreamingRollingSum(double width, Statistic statistic) :
+  width(width), statistic(statistic), roll_sum(0)
+{
+  if (!(width >= 0) || !std::isfinite(width))
+    throw std::invalid_argument("The rolling window width has to be non-negative and finite");
+}
+
+
+double StreamingRollingSum::update(double time, double value)
+{
+  // time  ... observation time
+  // value ... observation value
+
+  // Expand window on the right
+  window.push_back(Observation {time, value});
+  roll_sum = roll_sum + value;
+
+  // Shrink window on the left
+  while (!window.empty() && (window.front().time <= time - width)) {
+    roll_sum = roll_sum - window.front().value;
+    window.pop_front();
+  }
+
+  if (statistic == NUM_OBS)
+    return window.size();
+  else if (statistic == SUM)
+    return roll_sum;
+  else if (!window.empty())
+    return roll_sum / (ptrdiff_t) window.size();
+  else
+    return std::numeric_limits<double>::quiet_NaN();
+}
+
+
+std::string StreamingRollingSum::description() const
+{
+  const char *names[] = {"rolling_length", "rolling_sum", "rolling_mean"};
+  return format_description(names[statistic], "width", width);
+}
+
+
+void StreamingRollingSum::save_state(StateWriter& out) const
+{
+  out.put_double(width);
+  out.put_uint32(statistic);
+  out.put_double(roll_sum);
+  out.put_window(window);
+}
+
+
+void StreamingRollingSum::restore_state(StateReader& in)
+{
+  width = in.get_double();
+  uint32_t stat = in.get_uint32();
+  roll_sum = in.get_double();
+  in.get_window(window);
+  check_state((width >= 0) && std::isfinite(width) && (stat <= MEAN) && ((long long) window.size() <= num_obs));
+  statistic = (Statistic) stat;
+}
+
+
+
+/****************** StreamingRollingMinMax ******************/
+
+StreamingRollingMinMax::StreamingRollingMinMax(double width, bool maximum) :
+  width(width), maximum(maximum)
+{
+  if (!(width >= 0) || !std::isfinite(width))
+    throw std::invalid_argument("The rolling window width has to be non-negative and finite");
+}
+
+
+double StreamingRollingMinMax::update(double time, double value)
+{
+  // time  ... observation time
+  // value ... observation value
+
+  // Expand window on the right
+  // -) observations that can never become the maximum (minimum) again are dropped
+  if (maximum) {
+    while (!deque.empty() && (deque.back().value <= value))
+      deque.pop_back();
+  } else {
+    while (!deque.empty() && (deque.back().value >= value))
+      deque.pop_back();
+  }
+  deque.push_back(Observation {time, value});
+
+  // Drop observations that are no longer inside the window
+  while (!deque.empty() && (deque.front().time <= time - width))
+    deque.pop_front();
+
+  if (!deque.empty())
+    return deque.front().value;
+  else
+    return maximum ? -INFINITY : INFINITY;
+}
+
+
+std::string StreamingRollingMinMax::description() const
+{
+  return format_description(maximum ? "rolling_max" : "rolling_min", "width", width);
+}
+
+
+void StreamingRollingMinMax::save_state(StateWriter& out) const
+{
+  out.put_double(width);
+  out.put_uint32(maximum);
+  out.put_window(deque);
+}
+
+
+void StreamingRollingMinMax::restore_state(StateReader& in)
+{
+  width = in.get_double();
+  uint32_t is_max = in.get_uint32();
+  in.get_window(deque);
+  check_state((width >= 0) && std::isfinite(width) && (is_max <= 1) && ((long long) deque.size() <= num_obs));
+  maximum = is_max;
+}
+
+
+
+/****************** StreamingRollingMedian ******************/
+
+StreamingRollingMedian::StreamingRollingMedian(double width) :
+  width(width), sorted(NULL)
+{
+  if (!(width >= 0) || !std::isfinite(width))
+    throw std::invalid_argument("The rolling window width has to be non-negative and finite");
+  sorted = skiplist_create();
+}
+
+
+StreamingRollingMedian::~StreamingRollingMedian()
+{
+  skiplist_free(sorted);
+}
+
+
+double StreamingRollingMedian::update(double time, double value)
+{
+  // time  ... observation time
+  // value ... observation value
+
+  // Expand window on the right
+  window.push_back(Observation {time, value});
+  skiplist_insert(sorted, value);
+
+  // Shrink window on the left
+  while (!window.empty() && (window.front().time <= time - width)) {
+    skiplist_remove(sorted, window.front().value);
+    window.pop_front();
+  }
+
+  return skiplist_median(sorted);
+}
+
+
+std::string StreamingRollingMedian::description() const
+{
+  return format_description("rolling_median", "width", width);
+}
+
+
+void StreamingRollingMedian::save_state(StateWriter& out) const
+{
+  // The skiplist is not saved, because it can be rebuilt from the observations inside the rolling window
+  out.put_double(width);
+  out.put_window(window);
+}
+
+
+void StreamingRollingMedian::restore_state(StateReader& in)
+{
+  width = in.get_double();
+  in.get_window(window);
+  check_state((width >= 0) && std::isfinite(width) && ((long long) window.size() <= num_obs));
+
+  // Rebuild sorted observation values
+  for (std::size_t k = 0; k < window.size(); k++)
+    skiplist_insert(sorted, window[k].value);
+}
@@ -0,0 +1,310 @@
+// Copyright: 2012-2018 by Andreas Eckner
+// License: GPL-2 | GPL-3
+// Remark: Stateful streaming versions of the rolling operators, which receive one observation at a time via push() and
+//         return the same output values as the corresponding batch kernels with width_after=0 (i.e. for causal,
+//         right-aligned rolling time windows). The observation times need to be strictly increasing.
+//         The operator state can be saved to a versioned binary checkpoint, and restored after a process restart.
+
+#ifndef _streaming_h
+#define _streaming_h
+
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <stdexcept>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+extern "C" {
+#include "skiplist.h"
+}
+
+
+// Ring buffer (double-ended queue) that grows as needed and stores only the elements between front and back
+template <typename T>
+class RingBuffer
+{
+public:
+  RingBuffer() : head(0), count(0), data(8) {}
+
+  std::size_t size() const { return count; }
+  bool empty() const { return count == 0; }
+  void clear() { head = 0; count = 0; }
+
+  // Access k-th element, counting from the front
+  T& operator[](std::size_t k) { return data[(head + k) % data.size()]; }
+  const T& operator[](std::size_t k) const { return data[(head + k) % data.size()]; }
+  T& front() { return (*this)[0]; }
+  T& back() { return (*this)[count - 1]; }
+
+  void push_back(const T& x)
+  {
+    if (count == data.size())
+      grow();
+    data[(head + count) % data.size()] = x;
+    count++;
+  }
+  void pop_front() { head = (head + 1) % data.size(); count--; }
+  void pop_back() { count--; }
+
+private:
+  std::size_t head, count;
+  std::vector<T> data;
+
+  // Double the capacity, moving the elements to the beginning of the new storage
+  void grow()
+  {
+    std::vector<T> data_new(2 * data.size());
+    for (std::size_t k = 0; k < count; k++)
+      data_new[k] = (*this)[k];
+    data.swap(data_new);
+    head = 0;
+  }
+};
+
+
+// Observation (time, value) of a time series
+struct Observation
+{
+  double time;
+  double value;
+};
+
+
+// Serialization of operator state to a byte sequence (in little-endian byte order, independent of the platform)
+class StateWriter
+{
+public:
+  std::vector<unsigned char> bytes;
+
+  void put_uint32(uint32_t x)
+  {
+    for (int k = 0; k < 4; k++)
+      bytes.push_back((x >> (8 * k)) & 0xFF);
+  }
+  void put_uint64(uint64_t x)
+  {
+    for (int k = 0; k < 8; k++)
+      bytes.push_back((x >> (8 * k)) & 0xFF);
+  }
+  void put_double(double x)
+  {
+    uint64_t u;
+    std::memcpy(&u, &x, sizeof(double));
+    put_uint64(u);
+  }
+  void put_window(const RingBuffer<Observation>& window)
+  {
+    put_uint64(window.size());
+    for (std::size_t k = 0; k < window.size(); k++) {
+      put_double(window[k].time);
+      put_double(window[k].value);
+    }
+  }
+};
+
+
+// Deserialization of operator state from a byte sequence written by StateWriter
+class StateReader
+{
+public:
+  StateReader(const unsigned char data[], std::size_t size) : data(data), size(size), pos(0) {}
+
+  bool at_end() const { return pos == size; }
+  uint32_t get_uint32()
+  {
+    check_available(4);
+    uint32_t x = 0;
+    for (int k = 0; k < 4; k++)
+      x |= (uint32_t) data[pos++] << (8 * k);
+    return x;
+  }
+  uint64_t get_uint64()
+  {
+    check_available(8);
+    uint64_t x = 0;
+    for (int k = 0; k < 8; k++)
+      x |= (uint64_t) data[pos++] << (8 * k);
+    return x;
+  }
+  double get_double()
+  {
+    uint64_t u = get_uint64();
+    double x;
+    std::memcpy(&x, &u, sizeof(double));
+    return x;
+  }
+  void get_window(RingBuffer<Observation>& window)
+  {
+    uint64_t count = get_uint64();
+    if (count > (size - pos) / 16)
+      throw std::invalid_argument("Corrupt streaming operator state");
+    window.clear();
+    for (uint64_t k = 0; k < count; k++) {
+      Observation obs;
+      obs.time = get_double();
+      obs.value = get_double();
+      if (!std::isfinite(obs.time) || !std::isfinite(obs.value))
+        throw std::invalid_argument("Corrupt streaming operator state");
+      window.push_back(obs);
+    }
+  }
+
+private:
+  const unsigned char *data;
+  std::size_t size, pos;
+
+  void check_available(std::size_t num_bytes)
+  {
+    if (size - pos < num_bytes)
+      throw std::invalid_argument("Corrupt streaming operator state");
+  }
+};
+
+
+// Base class for all streaming operators
+class StreamingOperator
+{
+public:
+  StreamingOperator() : num_obs(0), time_last(0) {}
+  virtual ~StreamingOperator() {}
+
+  // Process a new observation and return the output value for its observation time
+  double push(double time, double value);
+
+  // Process several new observations, and store the output values for their observation times in 'values_new'
+  // -) all observations are checked first, so that the operator state is unchanged if one of them is invalid
+  void push(const double times[], const double values[], double values_new[], std::size_t n);
+
+  // Short human-readable description, such as "EMA_last(tau=3600s)"
+  virtual std::string description() const = 0;
+
+  // Save the operator state to a binary checkpoint, and restore an operator from such a checkpoint
+  // -) an operator restored from a checkpoint returns the same output values as the original operator
+  std::vector<unsigned char> save() const;
+  static StreamingOperator* restore(const unsigned char data[], std::size_t size);
+
+protected:
+  long long num_obs;      // number of observations pushed so far
+  double time_last;       // most recent observation time
+
+  // Operator type codes used in checkpoints (never change existing values)
+  enum Type {EMA = 1, SMA = 2, ROLLING_SUM = 3, ROLLING_MIN_MAX = 4, ROLLING_MEDIAN = 5};
+
+  virtual double update(double time, double value) = 0;
+  virtual Type type() const = 0;
+  virtual void save_state(StateWriter& out) const = 0;
+  virtual void restore_state(StateReader& in) = 0;
+};
+
+
+// EMA_last, EMA_next, EMA_lin (see ema.c)
+class StreamingEma : public StreamingOperator
+{
+public:
+  enum Interpolation {LAST, NEXT, LINEAR};
+  StreamingEma(double tau, Interpolation interpolation);
+
+protected:
+  double tau;
+  Interpolation interpolation;
+  double value_last;      // most recent observation value
+  double ema;             // current EMA value
+
+  double update(double time, double value);
+  std::string description() const;
+  Type type() const { return EMA; }
+  void save_state(StateWriter& out) const;
+  void restore_state(StateReader& in);
+};
+
+
+// SMA_last, SMA_next, SMA_linear (see sma.c)
+class StreamingSma : public StreamingOperator
+{
+public:
+  enum Interpolation {LAST, NEXT, LINEAR};
+  StreamingSma(double width, Interpolation interpolation);
+
+protected:
+  double width;
+  Interpolation interpolation;
+  RingBuffer<Observation> window;   // observations left - 1 (if it exists), ..., right
+  long long left;                   // index of first observation in rolling window (after the left end)
+  long long window_start;           // index of first observation in ring buffer
+  double roll_area, left_area, right_area;
+
+  double update(double time, double value);
+  std::string description() const;
+  Type type() const { return SMA; }
+  void save_state(StateWriter& out) const;
+  void restore_state(StateReader& in);
+  const Observation& obs(long long j) const { return window[j - window_start]; }
+};
+
+
+// Rolling number of observations, sum and mean (see rolling_num_obs, rolling_sum, rolling_mean)
+class StreamingRollingSum : public StreamingOperator
+{
+public:
+  enum Statistic {NUM_OBS, SUM, MEAN};
+  StreamingRollingSum(double width, Statistic statistic);
+
+protected:
+  double width;
+  Statistic statistic;
+  RingBuffer<Observation> window;   // observations inside rolling window
+  double roll_sum;
+
+  double update(double time, double value);
+  std::string description() const;
+  Type type() const { return ROLLING_SUM; }
+  void save_state(StateWriter& out) const;
+  void restore_state(StateReader& in);
+};
+
+
+// Rolling minimum and maximum (see rolling_min, rolling_max)
+class StreamingRollingMinMax : public StreamingOperator
+{
+public:
+  StreamingRollingMinMax(double width, bool maximum);
+
+protected:
+  double width;
+  bool maximum;
+  RingBuffer<Observation> deque;    // candidate observations with strictly monotonic values
+
+  double update(double time, double value);
+  std::string description() const;
+  Type type() const { return ROLLING_MIN_MAX; }
+  void save_state(StateWriter& out) const;
+  void restore_state(StateReader& in);
+};
+
+
+// Rolling median (see rolling_median)
+class StreamingRollingMedian : public StreamingOperator
+{
+public:
+  StreamingRollingMedian(double width);
+  ~StreamingRollingMedian();
+
+protected:
+  double width;
+  RingBuffer<Observation> window;   // observations inside rolling window
+  skiplist *sorted;                 // sorted observation values inside rolling window
+
+  double update(double time, double value);
+  std::string description() const;
+  Type type() const { return ROLLING_MEDIAN; }
+  void save_state(StateWriter& out) const;
+  void restore_state(StateReader& in);
+
+private:
+  StreamingRollingMedian(const StreamingRollingMedian&);
+  StreamingRollingMedian& operator=(const StreamingRollingMedian&);
+};
+
+#endif
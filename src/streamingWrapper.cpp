@@ -0,0 +1,105 @@
+#include <Rcpp.h>
+#include <string>
+#include "streaming.h"
+
+
+// [[Rcpp::export]]
+SEXP Rcpp_wrapper_streaming_ema_new(double tau, std::string interpolation)
+{
+  StreamingEma::Interpolation method;
+  if (interpolation == "last")
+    method = StreamingEma::LAST;
+  else if (interpolation == "next")
+    method = StreamingEma::NEXT;
+  else if (interpolation == "linear")
+    method = StreamingEma::LINEAR;
+  else
+    Rcpp::stop("Unknown sample path interpolation method");
+
+  Rcpp::XPtr<StreamingOperator> ptr(new StreamingEma(tau, method), true);
+  return ptr;
+}
+
+
+// [[Rcpp::export]]
+SEXP Rcpp_wrapper_streaming_sma_new(double width, std::string interpolation)
+{
+  StreamingSma::Interpolation method;
+  if (interpolation == "last")
+    method = StreamingSma::LAST;
+  else if (interpolation == "next")
+    method = StreamingSma::NEXT;
+  else if (interpolation == "linear")
+    method = StreamingSma::LINEAR;
+  else
+    Rcpp::stop("Unknown sample path interpolation method");
+
+  Rcpp::XPtr<StreamingOperator> ptr(new StreamingSma(width, method), true);
+  return ptr;
+}
+
+
+// [[Rcpp::export]]
+SEXP Rcpp_wrapper_streaming_rolling_new(double width, std::string statistic)
+{
+  StreamingOperator *op;
+  if (statistic == "length")
+    op = new StreamingRollingSum(width, StreamingRollingSum::NUM_OBS);
+  else if (statistic == "sum")
+    op = new StreamingRollingSum(width, StreamingRollingSum::SUM);
+  else if (statistic == "mean")
+    op = new StreamingRollingSum(width, StreamingRollingSum::MEAN);
+  else if (statistic == "max")
+    op = new StreamingRollingMinMax(width, true);
+  else if (statistic == "min")
+    op = new StreamingRollingMinMax(width, false);
+  else if (statistic == "median")
+    op = new StreamingRollingMedian(width);
+  else
+    Rcpp::stop("Unsupported rolling statistic");
+
+  Rcpp::XPtr<StreamingOperator> ptr(op, true);
+  return ptr;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::NumericVector Rcpp_wrapper_streaming_push(SEXP op, const Rcpp::NumericVector& times,
+  const Rcpp::NumericVector& values)
+{
+  // Allocate memory for output
+  Rcpp::XPtr<StreamingOperator> ptr(op);
+  R_xlen_t n = values.size();
+  Rcpp::NumericVector res(n);
+  if (times.size() != n)
+    Rcpp::stop("The length of 'times' and 'values' need to match");
+
+  // Process one observation at a time, after checking all of them
+  ptr->push(times.begin(), values.begin(), res.begin(), n);
+  return res;
+}
+
+
+// [[Rcpp::export]]
+std::string Rcpp_wrapper_streaming_description(SEXP op)
+{
+  Rcpp::XPtr<StreamingOperator> ptr(op);
+  return ptr->description();
+}
+
+
+// [[Rcpp::export]]
+Rcpp::RawVector Rcpp_wrapper_streaming_save(SEXP op)
+{
+  Rcpp::XPtr<StreamingOperator> ptr(op);
+  std::vector<unsigned char> state = ptr->save();
+  return Rcpp::RawVector(state.begin(), state.end());
+}
+
+
+// [[Rcpp::export]]
+SEXP Rcpp_wrapper_streaming_restore(const Rcpp::RawVector& state)
+{
+  Rcpp::XPtr<StreamingOperator> ptr(StreamingOperator::restore(state.begin(), state.size()), true);
+  return ptr;
+}
@@ -0,0 +1,149 @@
+// Copyright: 2012-2018 by Andreas Eckner
+// License: GPL-2 | GPL-3
+
+#include <math.h>
+#include "superaccumulator.h"
+
+#define SUPERACC_BASE ((int64_t) 1 << SUPERACC_DIGIT_BITS)
+
+
+// Propagate carries, so that digit[lo], ..., digit[*hi - 1] are in [0, 2^32) and digit[*hi] is in [-2^32, 2^32)
+static void propagate_carries(int64_t digit[], int lo, int *hi)
+{
+  // digit ... digits of a superaccumulator
+  // lo    ... index of lowest non-zero digit
+  // hi    ... index of highest non-zero digit (increased if necessary)
+
+  int64_t carry = 0, low;
+  int k;
+
+  for (k = lo; k < *hi; k++) {
+    digit[k] += carry;
+    low = digit[k] & (SUPERACC_BASE - 1);
+    carry = (digit[k] - low) / SUPERACC_BASE;
+    digit[k] = low;
+  }
+  digit[*hi] += carry;
+
+  // Move excess of highest digit to the next digit
+  while ((*hi < SUPERACC_NUM_DIGITS - 1) && ((digit[*hi] >= SUPERACC_BASE) || (digit[*hi] < -SUPERACC_BASE))) {
+    low = digit[*hi] & (SUPERACC_BASE - 1);
+    carry = (digit[*hi] - low) / SUPERACC_BASE;
+    digit[*hi] = low;
+    (*hi)++;
+    digit[*hi] += carry;
+  }
+}
+
+
+// Initialize a superaccumulator to zero
+void superacc_init(superaccumulator *acc)
+{
+  // acc ... superaccumulator
+
+  memset(acc->digit, 0, sizeof(acc->digit));
+  acc->lo = SUPERACC_NUM_DIGITS;
+  acc->hi = 0;
+  acc->num_pending = 0;
+}
+
+
+// Propagate carries, so that further values can be added without integer overflow
+void superacc_normalize(superaccumulator *acc)
+{
+  // acc ... superaccumulator
+
+  if (acc->lo <= acc->hi) {
+    propagate_carries(acc->digit, acc->lo, &acc->hi);
+    
+    // Shrink range of non-zero digits, e.g. after a tiny value left the rolling window
+    while ((acc->lo <= acc->hi) && (acc->digit[acc->lo] == 0))
+      acc->lo++;
+    while ((acc->hi > acc->lo) && (acc->digit[acc->hi] == 0))
+      acc->hi--;
+    if (acc->lo > acc->hi) {
+      acc->lo = SUPERACC_NUM_DIGITS;
+      acc->hi = 0;
+    }
+  }
+  acc->num_pending = 0;
+}
+
+
+// Return the sum rounded to the nearest double (ties to even)
+// -) results in the subnormal range, i.e. of magnitude less than 2^-1022, might be rounded twice
+// -) every call propagates the carries and rounds the leading digits, which takes about three times as long as adding
+//    and removing an observation value. The result is not cached, because in a rolling window the sum changes between
+//    almost all consecutive calls.
+double superacc_value(superaccumulator *acc)
+{
+  // acc ... superaccumulator
+
+  int64_t digit_neg[SUPERACC_NUM_DIGITS];
+  const int64_t *mag;
+  int lo, hi, h, k, lz;
+
+  // Determine the sign and the digits of the absolute value of the sum
+  // -) after propagating the carries, all digits except the highest one are non-negative
+  superacc_normalize(acc);
+  lo = acc->lo;
+  hi = acc->hi;
+  if (lo > hi)
+    return 0;
+  int negative = acc->digit[hi] < 0;
+  if (negative) {
+    for (k = lo; k <= hi; k++)
+      digit_neg[k] = -acc->digit[k];
+    propagate_carries(digit_neg, lo, &hi);
+    mag = digit_neg;
+  } else
+    mag = acc->digit;
+
+  // Find highest non-zero digit
+  for (h = hi; (h >= lo) && (mag[h] == 0); h--);
+  if (h < lo)
+    return 0;
+
+  // Collect the leading 64 bits in 'm', and whether any of the remaining bits is non-zero in 'sticky'
+  uint64_t d2 = (uint64_t) mag[h];
+  uint64_t d1 = (h - 1 >= lo) ? (uint64_t) mag[h - 1] : 0;
+  uint64_t d0 = (h - 2 >= lo) ? (uint64_t) mag[h - 2] : 0;
+  uint64_t m = (d2 << 32) | d1;
+#ifdef __GNUC__
+  lz = __builtin_clzll(m);
+#else
+  for (lz = 0; !(m & (UINT64_C(1) << 63)); lz++)
+    m <<= 1;
+  m >>= lz;
+#endif
+  m <<= lz;
+  int sticky = 0;
+  if (lz > 0) {
+    m |= d0 >> (32 - lz);
+    sticky = ((d0 << lz) & 0xFFFFFFFF) != 0;
+  } else
+    sticky = d0 != 0;
+  for (k = lo; k < h - 2; k++)
+    sticky |= mag[k] != 0;
+
+  // Round the leading 64 bits to 53 bits
+  uint64_t keep = m >> 11, rem = m & 0x7FF;
+  int exponent = SUPERACC_DIGIT_BITS * (h - 1) - lz - 1074 + 11;
+  if ((rem > 0x400) || ((rem == 0x400) && (sticky || (keep & 1))))
+    keep++;
+  if (keep >> 53) {
+    keep >>= 1;
+    exponent++;
+  }
+  
+  // Assemble the double directly if the result is in the normal range, which is much faster than ldexp()
+  double value;
+  int biased_exponent = exponent + 52 + 1023;
+  if ((biased_exponent >= 1) && (biased_exponent <= 2046)) {
+    uint64_t bits = ((uint64_t) negative << 63) | ((uint64_t) biased_exponent << 52) | (keep & ((UINT64_C(1) << 52) - 1));
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+  }
+  value = ldexp((double) keep, exponent);
+  return negative ? -value : value;
+}
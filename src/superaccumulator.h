@@ -0,0 +1,68 @@
+// Copyright: 2012-2018 by Andreas Eckner
+// License: GPL-2 | GPL-3
+// Remark: Fixed-point superaccumulator (see R. M. Neal, "Fast Exact Summation Using Small and Large
+//         Superaccumulators", 2015) for the exact sum of finite double values. The sum is stored as a fixed-point
+//         number with 32-bit digits covering the whole range of doubles, where each digit is kept in a 64-bit integer,
+//         so that carries only need to be propagated rarely. Adding and removing a value is exact, so a rolling sum
+//         has no accumulated rounding error at all, no matter how many values enter and leave the window.
+
+#ifndef _superaccumulator_h
+#define _superaccumulator_h
+
+#include <stdint.h>
+#include <string.h>
+
+#define SUPERACC_DIGIT_BITS 32
+#define SUPERACC_NUM_DIGITS 70                 // 2098 bits of finite doubles, plus room for carries
+#define SUPERACC_MAX_PENDING (1 << 29)         // maximum number of additions before carries need to be propagated
+
+typedef struct {
+  int64_t digit[SUPERACC_NUM_DIGITS];   // the sum is digit[k] * 2^(32 * k - 1074), summed over all k
+  int lo, hi;                           // all digits outside of digit[lo], ..., digit[hi] are zero
+  int num_pending;                      // number of additions since the last carry propagation
+} superaccumulator;
+
+void superacc_init(superaccumulator *acc);
+void superacc_normalize(superaccumulator *acc);
+double superacc_value(superaccumulator *acc);
+
+
+// Add (sign=1) or subtract (sign=-1) a finite value
+static inline void superacc_add(superaccumulator *acc, double value, int sign)
+{
+  // acc   ... superaccumulator
+  // value ... value to be added or subtracted
+  // sign  ... 1 to add, -1 to subtract
+
+  // Decompose the value into sign, integer mantissa, and position of lowest mantissa bit in units of 2^-1074
+  uint64_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  uint64_t mantissa = bits & ((UINT64_C(1) << 52) - 1);
+  int exponent = (int) ((bits >> 52) & 0x7FF);
+  if ((exponent == 0) && (mantissa == 0))   // zero
+    return;
+  if (exponent > 0) {                       // normal number
+    mantissa |= UINT64_C(1) << 52;
+    exponent--;
+  }
+  if (bits >> 63)
+    sign = -sign;
+
+  // Split the shifted mantissa (at most 84 bits) into three digits
+  int k = exponent / SUPERACC_DIGIT_BITS, shift = exponent % SUPERACC_DIGIT_BITS;
+  uint64_t low = (mantissa & 0xFFFFFFFF) << shift;
+  uint64_t high = (mantissa >> 32) << shift;
+  acc->digit[k] += sign * (int64_t) (low & 0xFFFFFFFF);
+  acc->digit[k + 1] += sign * (int64_t) ((low >> 32) + (high & 0xFFFFFFFF));
+  acc->digit[k + 2] += sign * (int64_t) (high >> 32);
+
+  // Update range of non-zero digits, leaving one digit for carries
+  if (k < acc->lo)
+    acc->lo = k;
+  if (k + 3 > acc->hi)
+    acc->hi = k + 3;
+  if (++acc->num_pending >= SUPERACC_MAX_PENDING)
+    superacc_normalize(acc);
+}
+
+#endif
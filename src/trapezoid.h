@@ -0,0 +1,38 @@
+// Copyright: 2012-2018 by Andreas Eckner
+// License: GPL-2 | GPL-3
+// Remark: Helper functions for calculating the area under a linearly interpolated sample path, shared by the batch
+//         and streaming implementations of SMA_linear
+
+#ifndef _trapezoid_h
+#define _trapezoid_h
+
+// Calculate the area of the trapezoid with corner coordinates (x2, 0), (x2, y2), (x3, 0), (x3, y3),
+// where y2 is obtained by linear interpolation of (x1, y1) and (x3, y3) evaluated at x2.
+static inline double trapezoid_left(double x1, double x2, double x3, double y1, double y3)
+{
+  // Degenerate cases
+  if ((x2 == x3) || (x2 < x1))
+    return (x3 - x2) * y1;
+  
+  // Find y2 using linear interpolation and calculate the trapezoid area
+  double w = (x3 - x2) / (x3 - x1);
+  double y2 = y1 * w + y3 * (1 - w);
+  return (x3 - x2) * (y2 + y3) / 2;
+}
+
+
+// Calculate the area of the trapezoid with corner coordinates (x1, 0), (x1, y1), (x2, 0), (x2, y2),
+// where y2 is obtained by linear interpolation of (x1, y1) and (x3, y3) evaluated at x2.
+static inline double trapezoid_right(double x1, double x2, double x3, double y1, double y3)
+{
+  // Degenerate cases
+  if ((x2 == x1) || (x2 > x3))
+    return (x2 - x1) * y1;
+  
+  // Find y2 using linear interpolation and calculate the trapezoid area
+  double w = (x3 - x2) / (x3 - x1);
+  double y2 = y1 * w + y3 * (1 - w);
+  return (x2 - x1) * (y1 + y2) / 2;
+}
+
+#endif
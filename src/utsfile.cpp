@@ -0,0 +1,506 @@
+// Copyright: 2012-2018 by Andreas Eckner
+// License: GPL-2 | GPL-3
+
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include "utsfile.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// File header
+#define UTSFILE_MAGIC 0x46535455u     // "UTSF" in little-endian byte order
+#define UTSFILE_VERSION 1u
+#define UTSFILE_HEADER_SIZE 40
+
+
+/****************** MappedFile ******************/
+
+#ifdef _WIN32
+
+MappedFile::MappedFile(const std::string& path, Mode mode, std::size_t size) :
+  path(path), mode(mode), bytes(NULL), num_bytes(0), handle(INVALID_HANDLE_VALUE), mapping(NULL)
+{
+  // path ... file name
+  // mode ... READ, WRITE, or CREATE
+  // size ... initial file size in bytes (only for mode CREATE)
+
+  DWORD access = (mode == READ) ? GENERIC_READ : (GENERIC_READ | GENERIC_WRITE);
+  DWORD disposition = (mode == CREATE) ? CREATE_ALWAYS : OPEN_EXISTING;
+  handle = CreateFileA(path.c_str(), access, FILE_SHARE_READ, NULL, disposition,
+    FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+  if (handle == INVALID_HANDLE_VALUE)
+    throw std::runtime_error("Cannot open file '" + path + "'");
+
+  if (mode == CREATE)
+    num_bytes = size;
+  else {
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(handle, &file_size)) {
+      CloseHandle(handle);
+      throw std::runtime_error("Cannot determine size of file '" + path + "'");
+    }
+    num_bytes = (std::size_t) file_size.QuadPart;
+  }
+  try {
+    map();
+  } catch (...) {
+    CloseHandle(handle);
+    throw;
+  }
+}
+
+
+MappedFile::~MappedFile()
+{
+  unmap();
+  CloseHandle(handle);
+}
+
+
+void MappedFile::map()
+{
+  // Empty files cannot be mapped
+  if (num_bytes == 0)
+    return;
+
+  // Creating a writable mapping extends the file to the requested size, if needed
+  LARGE_INTEGER size;
+  size.QuadPart = num_bytes;
+  mapping = CreateFileMappingA(handle, NULL, (mode == READ) ? PAGE_READONLY : PAGE_READWRITE, size.HighPart,
+    size.LowPart, NULL);
+  if (mapping == NULL)
+    throw std::runtime_error("Cannot map file '" + path + "' into memory");
+  bytes = (unsigned char *) MapViewOfFile(mapping, (mode == READ) ? FILE_MAP_READ : FILE_MAP_WRITE, 0, 0, 0);
+  if (bytes == NULL) {
+    CloseHandle(mapping);
+    mapping = NULL;
+    throw std::runtime_error("Cannot map file '" + path + "' into memory");
+  }
+}
+
+
+void MappedFile::unmap()
+{
+  if (bytes != NULL)
+    UnmapViewOfFile(bytes);
+  if (mapping != NULL)
+    CloseHandle(mapping);
+  bytes = NULL;
+  mapping = NULL;
+}
+
+
+void MappedFile::resize(std::size_t size)
+{
+  // size ... new file size in bytes
+
+  if (mode == READ)
+    throw std::logic_error("Cannot resize a read-only file");
+  unmap();
+
+  // Set the end of file (needed when shrinking), and map the file again
+  LARGE_INTEGER pos;
+  pos.QuadPart = size;
+  if (!SetFilePointerEx(handle, pos, NULL, FILE_BEGIN) || !SetEndOfFile(handle))
+    throw std::runtime_error("Cannot resize file '" + path + "'");
+  num_bytes = size;
+  map();
+}
+
+#else
+
+MappedFile::MappedFile(const std::string& path, Mode mode, std::size_t size) :
+  path(path), mode(mode), bytes(NULL), num_bytes(0), fd(-1)
+{
+  // path ... file name
+  // mode ... READ, WRITE, or CREATE
+  // size ... initial file size in bytes (only for mode CREATE)
+
+  int flags = (mode == READ) ? O_RDONLY : ((mode == WRITE) ? O_RDWR : (O_RDWR | O_CREAT | O_TRUNC));
+  fd = open(path.c_str(), flags, 0666);
+  if (fd < 0)
+    throw std::runtime_error("Cannot open file '" + path + "'");
+
+  if (mode == CREATE) {
+    if (ftruncate(fd, (off_t) size) != 0) {
+      close(fd);
+      throw std::runtime_error("Cannot resize file '" + path + "'");
+    }
+    num_bytes = size;
+  } else {
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+      close(fd);
+      throw std::runtime_error("Cannot determine size of file '" + path + "'");
+    }
+    num_bytes = (std::size_t) info.st_size;
+  }
+  try {
+    map();
+  } catch (...) {
+    close(fd);
+    throw;
+  }
+}
+
+
+MappedFile::~MappedFile()
+{
+  unmap();
+  close(fd);
+}
+
+
+void MappedFile::map()
+{
+  // Empty files cannot be mapped
+  if (num_bytes == 0)
+    return;
+
+  int prot = (mode == READ) ? PROT_READ : (PROT_READ | PROT_WRITE);
+  void *addr = mmap(NULL, num_bytes, prot, MAP_SHARED, fd, 0);
+  if (addr == MAP_FAILED)
+    throw std::runtime_error("Cannot map file '" + path + "' into memory");
+  bytes = (unsigned char *) addr;
+
+  // The kernels move forward through the data, so aggressive read-ahead pays off
+  madvise(addr, num_bytes, MADV_SEQUENTIAL);
+}
+
+
+void MappedFile::unmap()
+{
+  if (bytes != NULL)
+    munmap(bytes, num_bytes);
+  bytes = NULL;
+}
+
+
+void MappedFile::resize(std::size_t size)
+{
+  // size ... new file size in bytes
+
+  if (mode == READ)
+    throw std::logic_error("Cannot resize a read-only file");
+  unmap();
+  if (ftruncate(fd, (off_t) size) != 0)
+    throw std::runtime_error("Cannot resize file '" + path + "'");
+  num_bytes = size;
+  map();
+}
+
+#endif
+
+
+/****************** UtsFile ******************/
+
+// Read and write unsigned integers at a given byte offset (which need not be aligned)
+static inline uint64_t get_uint(const unsigned char *data, std::size_t offset, std::size_t num_bytes)
+{
+  uint64_t x = 0;
+  std::memcpy(&x, data + offset, num_bytes);
+  return x;
+}
+
+static inline void put_uint(unsigned char *data, std::size_t offset, std::size_t num_bytes, uint64_t x)
+{
+  std::memcpy(data + offset, &x, num_bytes);
+}
+
+
+// Throw an error for an invalid file, unless the condition holds
+static inline void check_file(bool condition)
+{
+  if (!condition)
+    throw std::invalid_argument("Corrupt time series file");
+}
+
+
+// Number of bytes needed for the header and column names, rounded up to a multiple of 8 bytes
+static std::size_t get_data_offset(const std::vector<std::string>& names)
+{
+  std::size_t offset = UTSFILE_HEADER_SIZE;
+  for (std::size_t k = 0; k < names.size(); k++)
+    offset += 4 + names[k].size();
+  return (offset + 7) / 8 * 8;
+}
+
+
+UtsFile::UtsFile(const std::string& path, bool writable) :
+  file(path, writable ? MappedFile::WRITE : MappedFile::READ), n(0), capacity(0), data_offset(0)
+{
+  // path     ... file name
+  // writable ... open file for appending?
+
+  read_header();
+}
+
+
+UtsFile::UtsFile(const std::string& path, const std::vector<std::string>& names, ptrdiff_t capacity) :
+  file(path, MappedFile::CREATE, get_data_offset(names) + (names.size() + 1) * capacity * sizeof(double)),
+  names(names), n(0), capacity(capacity), data_offset(get_data_offset(names))
+{
+  // path     ... file name
+  // names    ... column names
+  // capacity ... number of observations to reserve space for
+
+  write_header();
+}
+
+
+void UtsFile::read_header()
+{
+  const unsigned char *data = file.data();
+  check_file(file.size() >= UTSFILE_HEADER_SIZE);
+  if (get_uint(data, 0, 4) != UTSFILE_MAGIC)
+    throw std::invalid_argument("Not a time series file");
+  if (get_uint(data, 4, 4) != UTSFILE_VERSION)
+    throw std::invalid_argument("Unsupported time series file version");
+  uint64_t num_obs = get_uint(data, 8, 8);
+  uint64_t num_cols = get_uint(data, 16, 8);
+  uint64_t capacity_file = get_uint(data, 24, 8);
+  uint64_t offset = get_uint(data, 32, 8);
+
+  // Column names
+  std::size_t pos = UTSFILE_HEADER_SIZE;
+  check_file(num_cols <= (file.size() - pos) / 4);
+  names.clear();
+  for (uint64_t k = 0; k < num_cols; k++) {
+    check_file(file.size() - pos >= 4);
+    uint64_t len = get_uint(data, pos, 4);
+    pos += 4;
+    check_file(len <= file.size() - pos);
+    names.push_back(std::string((const char *) data + pos, len));
+    pos += len;
+  }
+
+  // Check that the data fits into the file
+  check_file((offset == get_data_offset(names)) && (offset <= file.size()) && (num_obs <= capacity_file));
+  check_file(capacity_file <= (file.size() - offset) / sizeof(double) / (num_cols + 1));
+  n = num_obs;
+  capacity = capacity_file;
+  data_offset = offset;
+}
+
+
+void UtsFile::write_header()
+{
+  unsigned char *data = file.data();
+  put_uint(data, 0, 4, UTSFILE_MAGIC);
+  put_uint(data, 4, 4, UTSFILE_VERSION);
+  put_uint(data, 8, 8, n);
+  put_uint(data, 16, 8, names.size());
+  put_uint(data, 24, 8, capacity);
+  put_uint(data, 32, 8, data_offset);
+
+  // Column names, followed by zero padding
+  std::size_t pos = UTSFILE_HEADER_SIZE;
+  for (std::size_t k = 0; k < names.size(); k++) {
+    put_uint(data, pos, 4, names[k].size());
+    std::memcpy(data + pos + 4, names[k].data(), names[k].size());
+    pos += 4 + names[k].size();
+  }
+  std::memset(data + pos, 0, data_offset - pos);
+}
+
+
+double* UtsFile::times() const
+{
+  return (double *) (file.data() + data_offset);
+}
+
+
+double* UtsFile::values(ptrdiff_t k) const
+{
+  // k ... column index
+
+  return times() + (k + 1) * capacity;
+}
+
+
+void UtsFile::set_num_obs(ptrdiff_t num_obs)
+{
+  // num_obs ... number of observations
+
+  if ((num_obs < 0) || (num_obs > capacity))
+    throw std::out_of_range("The number of observations exceeds the capacity of the time series file");
+  n = num_obs;
+  put_uint(file.data(), 8, 8, n);
+}
+
+
+void UtsFile::reserve(ptrdiff_t capacity_new)
+{
+  // capacity_new ... new capacity (at least the current capacity)
+
+  if (capacity_new <= capacity)
+    return;
+  file.resize(data_offset + (names.size() + 1) * capacity_new * sizeof(double));
+
+  // Move the value columns to their new positions, starting with the last column to avoid overwriting data
+  for (ptrdiff_t k = num_cols() - 1; k >= 0; k--) {
+    double *col = times() + (k + 1) * capacity;
+    std::memmove(col + (k + 1) * (capacity_new - capacity), col, n * sizeof(double));
+  }
+  capacity = capacity_new;
+  put_uint(file.data(), 24, 8, capacity);
+}
+
+
+void UtsFile::append(const double times_new[], const double values_new[], ptrdiff_t num_new)
+{
+  // times_new  ... strictly increasing observation times to append
+  // values_new ... observation values to append (num_new x num_cols() matrix in column-major order)
+  // num_new    ... number of observations to append
+
+  if (num_new <= 0)
+    return;
+
+  // Argument checking
+  if ((n > 0) && !(times_new[0] > times()[n - 1]))
+    throw std::invalid_argument("The appended observation times need to be after the last observation time in the file");
+  for (ptrdiff_t i = 1; i < num_new; i++) {
+    if (!(times_new[i] > times_new[i - 1]))
+      throw std::invalid_argument("The observation times need to be strictly increasing");
+  }
+
+  // At least double the capacity when growing, so that moving the columns has amortized constant cost
+  if (n + num_new > capacity)
+    reserve((n + num_new > 2 * capacity) ? n + num_new : 2 * capacity);
+
+  // Copy new observations
+  std::memcpy(times() + n, times_new, num_new * sizeof(double));
+  for (ptrdiff_t k = 0; k < num_cols(); k++)
+    std::memcpy(values(k) + n, values_new + k * num_new, num_new * sizeof(double));
+  set_num_obs(n + num_new);
+}
+
+
+/****************** Driver for kernels ******************/
+
+#ifdef _WIN32
+
+// Check that the output file differs from the input file, which would otherwise be truncated before being read. The
+// files are compared by volume and file index, so that different names for the same file (e.g. relative paths or hard
+// links) are detected as well.
+static void check_output_path(const std::string& path, const std::string& path_out)
+{
+  HANDLE handle = CreateFileA(path.c_str(), 0, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, NULL,
+    OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+  if (handle == INVALID_HANDLE_VALUE)
+    return;
+  HANDLE handle_out = CreateFileA(path_out.c_str(), 0, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, NULL,
+    OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+  if (handle_out == INVALID_HANDLE_VALUE) {
+    CloseHandle(handle);
+    return;
+  }
+
+  BY_HANDLE_FILE_INFORMATION info, info_out;
+  bool same = GetFileInformationByHandle(handle, &info) && GetFileInformationByHandle(handle_out, &info_out) &&
+    (info.dwVolumeSerialNumber == info_out.dwVolumeSerialNumber) && (info.nFileIndexHigh == info_out.nFileIndexHigh) &&
+    (info.nFileIndexLow == info_out.nFileIndexLow);
+  CloseHandle(handle);
+  CloseHandle(handle_out);
+  if (same)
+    throw std::invalid_argument("The input and output file need to be different");
+}
+
+#else
+
+// Check that the output file differs from the input file, which would otherwise be truncated before being read. The
+// files are compared by device and inode number, so that different names for the same file (e.g. relative paths,
+// symbolic links, or hard links) are detected as well.
+static void check_output_path(const std::string& path, const std::string& path_out)
+{
+  // A non-existing input file is reported when it is opened, and a non-existing output file is created
+  struct stat info, info_out;
+  if ((stat(path.c_str(), &info) != 0) || (stat(path_out.c_str(), &info_out) != 0))
+    return;
+  if ((info.st_dev == info_out.st_dev) && (info.st_ino == info_out.st_ino))
+    throw std::invalid_argument("The input and output file need to be different");
+}
+
+#endif
+
+
+// Check that the observation times are strictly increasing (e.g. for files created by other programs), as required by
+// the kernels
+static inline void check_times(const double times[], ptrdiff_t n)
+{
+  for (ptrdiff_t i = 1; i < n; i++) {
+    if (!(times[i] > times[i - 1]))
+      throw std::invalid_argument("The observation times need to be strictly increasing");
+  }
+}
+
+
+// Check that the observation values of a column are finite and not NA (e.g. for files created by other programs),
+// as required by the kernels
+static inline void check_values(const double values[], ptrdiff_t n)
+{
+  for (ptrdiff_t i = 0; i < n; i++) {
+    if (!std::isfinite(values[i]))
+      throw std::invalid_argument("The time series observation values have to be finite and not NA");
+  }
+}
+
+
+void uts_file_apply(const std::string& path, const std::string& path_out, window_kernel kernel, double width_before,
+  double width_after)
+{
+  // path         ... input file
+  // path_out     ... output file
+  // kernel       ... kernel, such as rolling_max_long or sma_last_long
+  // width_before ... (positive) width of rolling window before t_i
+  // width_after  ... (positive) width of rolling window after t_i
+
+  check_output_path(path, path_out);
+  UtsFile in(path, false);
+  check_times(in.times(), in.num_obs());
+  UtsFile out(path_out, in.column_names(), in.num_obs());
+  std::memcpy(out.times(), in.times(), in.num_obs() * sizeof(double));
+
+  // Process one column at a time
+  ptrdiff_t n = in.num_obs();
+  if (n > 0) {
+    for (ptrdiff_t k = 0; k < in.num_cols(); k++) {
+      check_values(in.values(k), n);
+      kernel(in.values(k), in.times(), &n, out.values(k), &width_before, &width_after);
+    }
+  }
+  out.set_num_obs(n);
+}
+
+
+void uts_file_apply(const std::string& path, const std::string& path_out, ema_kernel kernel, double tau)
+{
+  // path     ... input file
+  // path_out ... output file
+  // kernel   ... kernel, such as ema_last_long
+  // tau      ... effective temporal length of EMA
+
+  check_output_path(path, path_out);
+  UtsFile in(path, false);
+  check_times(in.times(), in.num_obs());
+  UtsFile out(path_out, in.column_names(), in.num_obs());
+  std::memcpy(out.times(), in.times(), in.num_obs() * sizeof(double));
+
+  // Process one column at a time
+  ptrdiff_t n = in.num_obs();
+  if (n > 0) {
+    for (ptrdiff_t k = 0; k < in.num_cols(); k++) {
+      check_values(in.values(k), n);
+      kernel(in.values(k), in.times(), &n, out.values(k), &tau);
+    }
+  }
+  out.set_num_obs(n);
+}
@@ -0,0 +1,112 @@
+// Copyright: 2012-2018 by Andreas Eckner
+// License: GPL-2 | GPL-3
+// Remark: Columnar binary file format for time series that do not fit into memory, and a driver that applies the
+//         kernels to memory-mapped files. The kernels only move forward through the observations, so the operating
+//         system can page the data in and out as needed, and the resident memory is bounded by the rolling time
+//         window plus I/O buffers, rather than by the length of the time series.
+//
+// File layout (native byte order, i.e. little-endian on all supported platforms):
+//   -) header: magic number "UTSF" (uint32), format version (uint32), number of observations n (uint64), number of
+//      columns (uint64), capacity (uint64), and byte offset of the observation times (uint64)
+//   -) column names: for each column, the number of characters (uint32) followed by the characters
+//   -) zero padding to a multiple of 8 bytes
+//   -) observation times: capacity doubles (seconds since the epoch), of which the first n are used
+//   -) observation values: for each column, capacity doubles, of which the first n are used
+// The capacity exceeds n only for files that were appended to, so that appending rarely needs to move the columns.
+
+#ifndef _utsfile_h
+#define _utsfile_h
+
+#include <cstddef>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+
+// Memory-mapped file
+class MappedFile
+{
+public:
+  enum Mode {READ, WRITE, CREATE};
+
+  // Open an existing file (READ, WRITE), or create a new file of the given size (CREATE)
+  MappedFile(const std::string& path, Mode mode, std::size_t size = 0);
+  ~MappedFile();
+
+  unsigned char* data() const { return bytes; }
+  std::size_t size() const { return num_bytes; }
+
+  // Change the file size (only for files opened with mode WRITE or CREATE)
+  void resize(std::size_t size);
+
+private:
+  std::string path;
+  Mode mode;
+  unsigned char *bytes;
+  std::size_t num_bytes;
+#ifdef _WIN32
+  void *handle;
+  void *mapping;
+#else
+  int fd;
+#endif
+
+  void map();
+  void unmap();
+  MappedFile(const MappedFile&);
+  MappedFile& operator=(const MappedFile&);
+};
+
+
+// Time series file with one or more value columns and shared observation times
+class UtsFile
+{
+public:
+  // Open an existing file for reading (writable=false) or appending (writable=true)
+  UtsFile(const std::string& path, bool writable);
+
+  // Create a new file without observations, and space for 'capacity' observations
+  UtsFile(const std::string& path, const std::vector<std::string>& names, ptrdiff_t capacity);
+
+  ptrdiff_t num_obs() const { return n; }
+  ptrdiff_t num_cols() const { return (ptrdiff_t) names.size(); }
+  const std::vector<std::string>& column_names() const { return names; }
+
+  // Observation times, and observation values of the k-th column (counting starts at zero)
+  double* times() const;
+  double* values(ptrdiff_t k) const;
+
+  // Append observations, where 'values' has the observation values of all columns in column-major order
+  // -) the observation times need to be strictly increasing, and after the last observation time in the file
+  void append(const double times_new[], const double values_new[], ptrdiff_t num_new);
+
+  // Set the number of observations (for writing observation values directly via times() and values())
+  void set_num_obs(ptrdiff_t num_obs);
+
+private:
+  MappedFile file;
+  std::vector<std::string> names;
+  ptrdiff_t n;
+  ptrdiff_t capacity;
+  std::size_t data_offset;
+
+  void read_header();
+  void write_header();
+  void reserve(ptrdiff_t capacity_new);
+  UtsFile(const UtsFile&);
+  UtsFile& operator=(const UtsFile&);
+};
+
+
+// Apply a kernel to each column of a time series file, and write the output to a new file with the same observation
+// times and column names
+typedef void (*window_kernel)(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *width_before, const double *width_after);
+typedef void (*ema_kernel)(const double values[], const double times[], const ptrdiff_t *n, double values_new[],
+  const double *tau);
+
+void uts_file_apply(const std::string& path, const std::string& path_out, window_kernel kernel, double width_before,
+  double width_after);
+void uts_file_apply(const std::string& path, const std::string& path_out, ema_kernel kernel, double tau);
+
+#endif
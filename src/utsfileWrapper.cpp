@@ -0,0 +1,130 @@
+#include <Rcpp.h>
+#include <climits>
+#include <string>
+#include "utsfile.h"
+
+extern "C" {
+#include "ema.h"
+#include "parallel.h"
+#include "rolling.h"
+#include "sma.h"
+}
+
+
+// Kernels with a rolling time window that can be applied to time series files
+static const struct {
+  const char *name;
+  window_kernel kernel;
+} window_kernels[] = {
+  {"rolling_kurtosis", rolling_kurtosis_long},
+  {"rolling_log_product", rolling_log_product_long},
+  {"rolling_max", rolling_max_long},
+  {"rolling_mean", rolling_mean_long},
+  {"rolling_median", rolling_median_long},
+  {"rolling_min", rolling_min_long},
+  {"rolling_num_obs", rolling_num_obs_long},
+  {"rolling_product", rolling_product_long},
+  {"rolling_sd", rolling_sd_long},
+  {"rolling_skewness", rolling_skewness_long},
+  {"rolling_sum", rolling_sum_long},
+  {"rolling_sum_exact", rolling_sum_exact_long},
+  {"rolling_sum_neumaier", rolling_sum_neumaier_long},
+  {"rolling_sum_stable", rolling_sum_stable_long},
+  {"rolling_var", rolling_var_long},
+  {"sma_last", sma_last_long},
+  {"sma_linear", sma_linear_long},
+  {"sma_next", sma_next_long}
+};
+
+
+// EMA kernels that can be applied to time series files
+static const struct {
+  const char *name;
+  ema_kernel kernel;
+} ema_kernels[] = {
+  {"ema_last", ema_last_long},
+  {"ema_linear", ema_linear_long},
+  {"ema_next", ema_next_long}
+};
+
+
+// [[Rcpp::export]]
+void Rcpp_wrapper_uts_file_write(std::string path, const Rcpp::NumericVector& times,
+  const Rcpp::NumericMatrix& values, std::vector<std::string> names, bool append)
+{
+  ptrdiff_t n = times.size();
+  if ((values.nrow() != n) || (values.ncol() != (int) names.size()))
+    Rcpp::stop("The dimensions of 'values' do not match the observation times and column names");
+
+  // Create a new file, or check that the existing file has the same columns
+  if (append) {
+    UtsFile file(path, true);
+    if (file.column_names() != names)
+      Rcpp::stop("The time series file has different columns");
+    file.append(times.begin(), values.begin(), n);
+  } else {
+    UtsFile file(path, names, n);
+    file.append(times.begin(), values.begin(), n);
+  }
+}
+
+
+// [[Rcpp::export]]
+Rcpp::List Rcpp_wrapper_uts_file_info(std::string path)
+{
+  UtsFile file(path, false);
+  ptrdiff_t n = file.num_obs();
+  return Rcpp::List::create(
+    Rcpp::Named("num_obs") = (double) n,
+    Rcpp::Named("names") = file.column_names(),
+    Rcpp::Named("start") = (n > 0) ? file.times()[0] : NA_REAL,
+    Rcpp::Named("end") = (n > 0) ? file.times()[n - 1] : NA_REAL
+  );
+}
+
+
+// [[Rcpp::export]]
+Rcpp::List Rcpp_wrapper_uts_file_read(std::string path, double start, double end)
+{
+  // Determine the observations inside the time window [start, end]
+  UtsFile file(path, false);
+  ptrdiff_t first = first_index_at_or_after(file.times(), file.num_obs(), start);
+  ptrdiff_t last = first_index_after(file.times(), file.num_obs(), end);
+  ptrdiff_t n = (last > first) ? last - first : 0;
+  if (n > INT_MAX)
+    Rcpp::stop("Too many observations for reading at once. Use arguments 'start' and 'end' to read a subperiod.");
+
+  // Copy observations
+  Rcpp::NumericVector times(file.times() + first, file.times() + first + n);
+  Rcpp::NumericMatrix values(n, file.num_cols());
+  for (ptrdiff_t k = 0; k < file.num_cols(); k++)
+    std::copy(file.values(k) + first, file.values(k) + first + n, values.begin() + k * n);
+  return Rcpp::List::create(Rcpp::Named("times") = times, Rcpp::Named("values") = values);
+}
+
+
+// [[Rcpp::export]]
+void Rcpp_wrapper_uts_file_apply(std::string path, std::string path_out, std::string C_fct, double width_before,
+  double width_after)
+{
+  for (std::size_t j = 0; j < sizeof(window_kernels) / sizeof(window_kernels[0]); j++) {
+    if (C_fct == window_kernels[j].name) {
+      uts_file_apply(path, path_out, window_kernels[j].kernel, width_before, width_after);
+      return;
+    }
+  }
+  Rcpp::stop("This C function cannot be applied to time series files");
+}
+
+
+// [[Rcpp::export]]
+void Rcpp_wrapper_uts_file_apply_ema(std::string path, std::string path_out, std::string C_fct, double tau)
+{
+  for (std::size_t j = 0; j < sizeof(ema_kernels) / sizeof(ema_kernels[0]); j++) {
+    if (C_fct == ema_kernels[j].name) {
+      uts_file_apply(path, path_out, ema_kernels[j].kernel, tau);
+      return;
+    }
+  }
+  Rcpp::stop("This C function cannot be applied to time series files");
+}